@@ -0,0 +1,90 @@
+#include "array/array_noise.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#define SIGNAL_SIZE 200000U
+#define REPEATS 5U
+
+static int32_t input[SIGNAL_SIZE];
+static int32_t output[SIGNAL_SIZE];
+
+/* =============================== *
+ *      NAIVE REFERENCE FILTER     *
+ * =============================== */
+static void naive_fir(const int16_t* taps, size_t tap_count, const int32_t* in, int32_t* out,
+                      size_t size)
+{
+    for (size_t n = 0U; n < size; ++n)
+    {
+        int64_t acc = 0;
+        for (size_t k = 0U; k < tap_count && k <= n; ++k)
+        {
+            acc += (int64_t) taps[k] * in[n - k];
+        }
+        out[n] = (int32_t) ((acc + (1 << 14)) >> 15);
+    }
+}
+
+// Symmetric low-pass window (triangle), normalized to ~1.0 in Q15
+static void make_lowpass(int16_t* taps, size_t tap_count)
+{
+    int32_t total = 0;
+    for (size_t k = 0U; k < tap_count; ++k)
+    {
+        size_t dist = (k < tap_count - 1U - k) ? k : tap_count - 1U - k;
+        taps[k] = (int16_t) (dist + 1U);
+        total += taps[k];
+    }
+
+    for (size_t k = 0U; k < tap_count; ++k)
+    {
+        taps[k] = (int16_t) ((taps[k] * 32767) / total);
+    }
+}
+
+/* =============================== *
+ *         BENCHMARK: FIR          *
+ * =============================== */
+static void run_benchmark(size_t tap_count)
+{
+    int16_t taps[FIR_MAX_TAPS];
+    array_fir_t fir;
+
+    make_lowpass(taps, tap_count);
+    array_fir_init(&fir, taps, tap_count, 15U);
+
+    clock_t start = clock();
+    for (size_t r = 0U; r < REPEATS; ++r)
+    {
+        naive_fir(taps, tap_count, input, output, SIGNAL_SIZE);
+    }
+    double naive_ms = 1000.0 * (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for (size_t r = 0U; r < REPEATS; ++r)
+    {
+        array_fir_reset(&fir);
+        array_fir_process(&fir, input, output, SIGNAL_SIZE, CLAMP_INT32);
+    }
+    double fir_ms = 1000.0 * (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    printf("%3zu taps: naive %8.2f ms, array_fir_process %8.2f ms (x%.1f)\n", tap_count,
+           naive_ms / REPEATS, fir_ms / REPEATS, (fir_ms > 0.0) ? naive_ms / fir_ms : 0.0);
+}
+
+int main(void)
+{
+    for (size_t i = 0U; i < SIGNAL_SIZE; ++i)
+    {
+        input[i] = (int32_t) ((i * 7919U) % 2001U) - 1000;
+    }
+
+    printf("[FIR] %u samples, average of %u runs\n", SIGNAL_SIZE, REPEATS);
+    run_benchmark(8U);
+    run_benchmark(32U);
+    run_benchmark(128U);
+
+    return 0;
+}
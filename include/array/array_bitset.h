@@ -0,0 +1,550 @@
+/**
+ * @file array_bitset.h
+ * @brief Packed bitset over uint64_t words with whole-word bulk operations.
+ *
+ * `BIT()` / `SET_BIT()` from `common_macros.h` work on one bit of a 32-bit register; this module
+ * handles large flag sets 64 bits at a time. Ranges are set or cleared with word masks, the
+ * logical operations are plain word loops that vectorize, and counts / searches use the
+ * compiler's popcount and count-trailing-zeros builtins (with a portable fallback).
+ *
+ * The storage is owned by the caller (`BITSET_WORDS(bits)` words). Bits past the logical size
+ * in the last word are always kept at zero.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_BITSET_H
+#define ARRAY_BITSET_H
+
+#include "array_status.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------
+//   Configuration
+// -----------------------------
+
+/** Bits per storage word. */
+#define BITSET_WORD_BITS 64U
+
+/** Number of `uint64_t` words needed for `bits` bits. */
+#define BITSET_WORDS(bits) (((bits) + BITSET_WORD_BITS - 1U) / BITSET_WORD_BITS)
+
+/** 64-bit counterpart of `BIT()`: mask of bit `n` inside its word. */
+#define BITSET_BIT(n) ((uint64_t) 1U << ((n) % BITSET_WORD_BITS))
+
+// -----------------------------
+//   Type Definitions
+// -----------------------------
+
+/**
+ * @brief Bitset view over caller-provided words.
+ */
+typedef struct
+{
+    uint64_t* words; /**< Storage, BITSET_WORDS(bits) words */
+    size_t bits;     /**< Logical number of bits */
+} array_bitset_t;
+
+// -----------------------------
+//   Helpers
+// -----------------------------
+
+/**
+ * @brief Number of set bits in a word.
+ */
+static inline unsigned bitset_popcount64(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned) __builtin_popcountll(word);
+#else
+    word = word - ((word >> 1) & 0x5555555555555555U);
+    word = (word & 0x3333333333333333U) + ((word >> 2) & 0x3333333333333333U);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FU;
+    return (unsigned) ((word * 0x0101010101010101U) >> 56);
+#endif
+}
+
+/**
+ * @brief Index of the lowest set bit of a non-zero word.
+ */
+static inline unsigned bitset_ctz64(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned) __builtin_ctzll(word);
+#else
+    return bitset_popcount64((word & (0U - word)) - 1U);
+#endif
+}
+
+/**
+ * @brief Mask of bits [lo, hi) within one word (0 <= lo < hi <= 64).
+ */
+static inline uint64_t bitset_word_mask(size_t lo, size_t hi)
+{
+    uint64_t upper = (hi == BITSET_WORD_BITS) ? ~(uint64_t) 0U : (((uint64_t) 1U << hi) - 1U);
+    return upper & ~(((uint64_t) 1U << lo) - 1U);
+}
+
+/**
+ * @brief Validates a bitset and a [start, start + count) range inside it.
+ */
+static inline array_status_t bitset_check_range(const array_bitset_t* bs, size_t start,
+                                                size_t count)
+{
+    if (bs == NULL || bs->words == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (count == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if (start > bs->bits || count > bs->bits - start)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Sets (value = true) or clears every bit of [start, start + count) word by word.
+ */
+static inline void bitset_fill_range(array_bitset_t* bs, size_t start, size_t count, bool value)
+{
+    size_t end = start + count;
+    size_t first = start / BITSET_WORD_BITS;
+    size_t last = (end - 1U) / BITSET_WORD_BITS;
+
+    for (size_t w = first; w <= last; ++w)
+    {
+        size_t lo = (w == first) ? start % BITSET_WORD_BITS : 0U;
+        size_t hi = (w == last) ? end - last * BITSET_WORD_BITS : BITSET_WORD_BITS;
+        uint64_t mask = bitset_word_mask(lo, hi);
+
+        bs->words[w] = value ? (bs->words[w] | mask) : (bs->words[w] & ~mask);
+    }
+}
+
+// -----------------------------
+//   Setup
+// -----------------------------
+
+/**
+ * @brief Attaches storage to a bitset and clears all bits.
+ *
+ * @param bs    Pointer to the bitset.
+ * @param words Storage of at least `BITSET_WORDS(bits)` words.
+ * @param bits  Logical number of bits.
+ *
+ * @retval ARRAY_STATUS_OK          Bitset ready, all bits clear.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY bits was 0.
+ */
+static inline array_status_t array_bitset_init(array_bitset_t* bs, uint64_t* words, size_t bits)
+{
+    if (bs == NULL || words == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (bits == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    bs->words = words;
+    bs->bits = bits;
+
+    for (size_t w = 0U; w < BITSET_WORDS(bits); ++w)
+    {
+        words[w] = 0U;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Single bits and ranges
+// -----------------------------
+
+/**
+ * @brief Returns whether bit `index` is set (false for a NULL bitset or out-of-range index).
+ */
+static inline bool array_bitset_test(const array_bitset_t* bs, size_t index)
+{
+    if (bs == NULL || bs->words == NULL || index >= bs->bits)
+    {
+        return false;
+    }
+
+    return (bs->words[index / BITSET_WORD_BITS] & BITSET_BIT(index)) != 0U;
+}
+
+/**
+ * @brief Sets bits [start, start + count).
+ *
+ * @param bs    Pointer to an initialized bitset.
+ * @param start First bit.
+ * @param count Number of bits.
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         count was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT Range exceeds the bitset.
+ */
+static inline array_status_t array_bitset_set_range(array_bitset_t* bs, size_t start, size_t count)
+{
+    array_status_t status = bitset_check_range(bs, start, count);
+    if (status == ARRAY_STATUS_OK)
+    {
+        bitset_fill_range(bs, start, count, true);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Clears bits [start, start + count).
+ *
+ * @see array_bitset_set_range()
+ */
+static inline array_status_t array_bitset_clear_range(array_bitset_t* bs, size_t start,
+                                                      size_t count)
+{
+    array_status_t status = bitset_check_range(bs, start, count);
+    if (status == ARRAY_STATUS_OK)
+    {
+        bitset_fill_range(bs, start, count, false);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Counts the set bits in [start, start + count).
+ *
+ * "All set" is `*out_count == count`, "any set" is `*out_count != 0`.
+ *
+ * @param bs        Pointer to an initialized bitset.
+ * @param start     First bit.
+ * @param count     Number of bits.
+ * @param out_count Pointer where the number of set bits will be stored.
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         count was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT Range exceeds the bitset.
+ */
+static inline array_status_t array_bitset_count_range(const array_bitset_t* bs, size_t start,
+                                                      size_t count, size_t* out_count)
+{
+    if (out_count == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    array_status_t status = bitset_check_range(bs, start, count);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    size_t end = start + count;
+    size_t first = start / BITSET_WORD_BITS;
+    size_t last = (end - 1U) / BITSET_WORD_BITS;
+    size_t total = 0U;
+
+    for (size_t w = first; w <= last; ++w)
+    {
+        size_t lo = (w == first) ? start % BITSET_WORD_BITS : 0U;
+        size_t hi = (w == last) ? end - last * BITSET_WORD_BITS : BITSET_WORD_BITS;
+        total += bitset_popcount64(bs->words[w] & bitset_word_mask(lo, hi));
+    }
+
+    *out_count = total;
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Number of set bits in the whole bitset.
+ *
+ * @param bs        Pointer to an initialized bitset.
+ * @param out_count Pointer where the number of set bits will be stored.
+ *
+ * @retval ARRAY_STATUS_OK         Success.
+ * @retval ARRAY_STATUS_ERROR_NULL NULL pointer was passed.
+ */
+static inline array_status_t array_bitset_popcount(const array_bitset_t* bs, size_t* out_count)
+{
+    if (bs == NULL || bs->words == NULL || out_count == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    size_t total = 0U;
+    for (size_t w = 0U; w < BITSET_WORDS(bs->bits); ++w)
+    {
+        total += bitset_popcount64(bs->words[w]);
+    }
+
+    *out_count = total;
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Logical operations
+// -----------------------------
+
+/**
+ * @brief Logical operation between two bitsets.
+ */
+typedef enum
+{
+    BITSET_OP_AND,   /**< dst = a & b */
+    BITSET_OP_OR,    /**< dst = a | b */
+    BITSET_OP_XOR,   /**< dst = a ^ b */
+    BITSET_OP_ANDNOT /**< dst = a & ~b */
+} bitset_op_t;
+
+/**
+ * @brief Combines two bitsets of the same size word by word (`dst` may alias `a` or `b`).
+ *
+ * @param dst Output bitset.
+ * @param a   First operand.
+ * @param b   Second operand.
+ * @param op  Operation.
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT The bitsets differ in size.
+ */
+static inline array_status_t array_bitset_combine(array_bitset_t* dst, const array_bitset_t* a,
+                                                  const array_bitset_t* b, bitset_op_t op)
+{
+    if (dst == NULL || a == NULL || b == NULL || dst->words == NULL || a->words == NULL ||
+        b->words == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (a->bits != b->bits || a->bits != dst->bits)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    const size_t words = BITSET_WORDS(dst->bits);
+    uint64_t* out = dst->words;
+    const uint64_t* x = a->words;
+    const uint64_t* y = b->words;
+
+    // One loop per op keeps each body a single vectorizable word operation
+    switch (op)
+    {
+    case BITSET_OP_AND:
+        for (size_t w = 0U; w < words; ++w)
+        {
+            out[w] = x[w] & y[w];
+        }
+        break;
+    case BITSET_OP_OR:
+        for (size_t w = 0U; w < words; ++w)
+        {
+            out[w] = x[w] | y[w];
+        }
+        break;
+    case BITSET_OP_XOR:
+        for (size_t w = 0U; w < words; ++w)
+        {
+            out[w] = x[w] ^ y[w];
+        }
+        break;
+    default:
+        for (size_t w = 0U; w < words; ++w)
+        {
+            out[w] = x[w] & ~y[w];
+        }
+        break;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/** @brief `dst = a & b`. @see array_bitset_combine() */
+static inline array_status_t array_bitset_and(array_bitset_t* dst, const array_bitset_t* a,
+                                              const array_bitset_t* b)
+{
+    return array_bitset_combine(dst, a, b, BITSET_OP_AND);
+}
+
+/** @brief `dst = a | b`. @see array_bitset_combine() */
+static inline array_status_t array_bitset_or(array_bitset_t* dst, const array_bitset_t* a,
+                                             const array_bitset_t* b)
+{
+    return array_bitset_combine(dst, a, b, BITSET_OP_OR);
+}
+
+/** @brief `dst = a ^ b`. @see array_bitset_combine() */
+static inline array_status_t array_bitset_xor(array_bitset_t* dst, const array_bitset_t* a,
+                                              const array_bitset_t* b)
+{
+    return array_bitset_combine(dst, a, b, BITSET_OP_XOR);
+}
+
+/** @brief `dst = a & ~b`. @see array_bitset_combine() */
+static inline array_status_t array_bitset_andnot(array_bitset_t* dst, const array_bitset_t* a,
+                                                 const array_bitset_t* b)
+{
+    return array_bitset_combine(dst, a, b, BITSET_OP_ANDNOT);
+}
+
+// -----------------------------
+//   Search and index lists
+// -----------------------------
+
+/**
+ * @brief Finds the first set bit at or after `from`, skipping zero words.
+ *
+ * @param bs        Pointer to an initialized bitset.
+ * @param from      First bit to consider.
+ * @param out_index Pointer set to the bit index, or to `bs->bits` if there is none.
+ *
+ * @retval ARRAY_STATUS_OK         Search completed (check `*out_index`).
+ * @retval ARRAY_STATUS_ERROR_NULL NULL pointer was passed.
+ */
+static inline array_status_t array_bitset_find_next(const array_bitset_t* bs, size_t from,
+                                                    size_t* out_index)
+{
+    if (bs == NULL || bs->words == NULL || out_index == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    *out_index = bs->bits;
+    if (from >= bs->bits)
+    {
+        return ARRAY_STATUS_OK;
+    }
+
+    const size_t words = BITSET_WORDS(bs->bits);
+    size_t w = from / BITSET_WORD_BITS;
+    uint64_t word = bs->words[w] & ~((BITSET_BIT(from)) - 1U);
+
+    while (word == 0U)
+    {
+        if (++w >= words)
+        {
+            return ARRAY_STATUS_OK;
+        }
+        word = bs->words[w];
+    }
+
+    *out_index = w * BITSET_WORD_BITS + bitset_ctz64(word);
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Finds the first set bit.
+ *
+ * @see array_bitset_find_next()
+ */
+static inline array_status_t array_bitset_find_first(const array_bitset_t* bs, size_t* out_index)
+{
+    return array_bitset_find_next(bs, 0U, out_index);
+}
+
+/**
+ * @brief Sets the bit of every index in a list (validated first; nothing is set on error).
+ *
+ * @param bs    Pointer to an initialized bitset.
+ * @param idx   Index list.
+ * @param count Number of indices.
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         count was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT An index was out of range.
+ */
+static inline array_status_t array_bitset_from_indices(array_bitset_t* bs, const size_t* idx,
+                                                       size_t count)
+{
+    if (bs == NULL || bs->words == NULL || idx == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (count == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    uint32_t invalid = 0U;
+    for (size_t i = 0U; i < count; ++i)
+    {
+        invalid |= (uint32_t) (idx[i] >= bs->bits);
+    }
+
+    if (invalid)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+        bs->words[idx[i] / BITSET_WORD_BITS] |= BITSET_BIT(idx[i]);
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Writes the indices of all set bits in increasing order.
+ *
+ * Each word is consumed by repeatedly taking its lowest set bit, so the cost is proportional to
+ * the number of words plus the number of set bits.
+ *
+ * @param bs        Pointer to an initialized bitset.
+ * @param out_idx   Output index list.
+ * @param capacity  Number of entries available in `out_idx`.
+ * @param out_count Pointer where the number of written indices will be stored.
+ *
+ * @retval ARRAY_STATUS_OK                     All set bits were written.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP Output truncated to `capacity` indices.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ */
+static inline array_status_t array_bitset_to_indices(const array_bitset_t* bs, size_t* out_idx,
+                                                     size_t capacity, size_t* out_count)
+{
+    if (bs == NULL || bs->words == NULL || out_idx == NULL || out_count == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    size_t n = 0U;
+
+    for (size_t w = 0U; w < BITSET_WORDS(bs->bits); ++w)
+    {
+        uint64_t word = bs->words[w];
+
+        while (word != 0U)
+        {
+            if (n == capacity)
+            {
+                *out_count = n;
+                return ARRAY_STATUS_WARNING_OVERFLOW_CLAMP;
+            }
+
+            out_idx[n++] = w * BITSET_WORD_BITS + bitset_ctz64(word);
+            word &= word - 1U;
+        }
+    }
+
+    *out_count = n;
+    return ARRAY_STATUS_OK;
+}
+
+#endif // ARRAY_BITSET_H
@@ -0,0 +1,284 @@
+/**
+ * @file array_compare.h
+ * @brief Array equality, first mismatch, changed-block detection and checksum quick-reject.
+ *
+ * Differences are accumulated as `a[i] ^ b[i]` OR-ed over a block, which compiles to wide
+ * XOR / OR instructions with a single branch per block. `array_equal()` and
+ * `array_first_mismatch()` stop at the first differing block.
+ *
+ * For arrays that are compared again and again (e.g. a frame against the last one sent), keep
+ * the `array_checksum()` of each and call `array_equal_checksum()`: differing checksums reject
+ * immediately, and only equal checksums pay for the full compare.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_COMPARE_H
+#define ARRAY_COMPARE_H
+
+#include "array_status.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------
+//   Configuration
+// -----------------------------
+
+/** Elements per block between two early-exit checks. */
+#define COMPARE_BLOCK 64U
+
+/** Number of blocks of `block` elements covering `size` elements (output size of block diff). */
+#define COMPARE_BLOCKS(size, block) (((size) + (block) - 1U) / (block))
+
+// -----------------------------
+//   Helpers
+// -----------------------------
+
+/**
+ * @brief Validates the common arguments of all compare kernels.
+ */
+static inline array_status_t compare_check(const int32_t* a, const int32_t* b, size_t size,
+                                           const void* out)
+{
+    if (a == NULL || b == NULL || out == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Returns non-zero if a[start .. end - 1] and b[start .. end - 1] differ.
+ */
+static inline uint32_t compare_range_differs(const int32_t* a, const int32_t* b, size_t start,
+                                             size_t end)
+{
+    uint32_t diff = 0U;
+
+    for (size_t i = start; i < end; ++i)
+    {
+        diff |= (uint32_t) a[i] ^ (uint32_t) b[i];
+    }
+
+    return diff;
+}
+
+/**
+ * @brief First index where `a` and `b` differ, or `size`.
+ */
+static inline size_t compare_mismatch(const int32_t* a, const int32_t* b, size_t size)
+{
+    for (size_t base = 0U; base < size; base += COMPARE_BLOCK)
+    {
+        size_t end = (size - base < COMPARE_BLOCK) ? size : base + COMPARE_BLOCK;
+
+        if (compare_range_differs(a, b, base, end))
+        {
+            for (size_t i = base; i < end; ++i)
+            {
+                if (a[i] != b[i])
+                {
+                    return i;
+                }
+            }
+        }
+    }
+
+    return size;
+}
+
+// -----------------------------
+//   Equality
+// -----------------------------
+
+/**
+ * @brief Tests whether two arrays hold the same elements.
+ *
+ * @param a         First array.
+ * @param b         Second array.
+ * @param size      Number of elements in each array.
+ * @param out_equal Pointer where the result will be stored.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_equal(const int32_t* a, const int32_t* b, size_t size,
+                                         bool* out_equal)
+{
+    array_status_t status = compare_check(a, b, size, out_equal);
+    if (status == ARRAY_STATUS_OK)
+    {
+        *out_equal = (a == b) || compare_mismatch(a, b, size) == size;
+    }
+
+    return status;
+}
+
+/**
+ * @brief Finds the first index where two arrays differ.
+ *
+ * @param a         First array.
+ * @param b         Second array.
+ * @param size      Number of elements in each array.
+ * @param out_index Pointer set to the first differing index, or to `size` if the arrays are equal.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_first_mismatch(const int32_t* a, const int32_t* b, size_t size,
+                                                  size_t* out_index)
+{
+    array_status_t status = compare_check(a, b, size, out_index);
+    if (status == ARRAY_STATUS_OK)
+    {
+        *out_index = compare_mismatch(a, b, size);
+    }
+
+    return status;
+}
+
+// -----------------------------
+//   Block diff
+// -----------------------------
+
+/**
+ * @brief Lists the blocks of `block_size` elements that differ between two arrays.
+ *
+ * Block `k` covers elements [k * block_size, (k + 1) * block_size); the last block may be
+ * shorter. Indices are written in increasing order.
+ *
+ * @param a          First array.
+ * @param b          Second array.
+ * @param size       Number of elements in each array.
+ * @param block_size Elements per block.
+ * @param out_blocks Output list with room for `COMPARE_BLOCKS(size, block_size)` entries.
+ * @param out_count  Pointer where the number of changed blocks will be stored.
+ *
+ * @retval ARRAY_STATUS_OK                  Success (the count may be 0).
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT block_size was 0.
+ */
+static inline array_status_t array_block_diff(const int32_t* a, const int32_t* b, size_t size,
+                                              size_t block_size, size_t* out_blocks,
+                                              size_t* out_count)
+{
+    array_status_t status = compare_check(a, b, size, out_blocks);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    if (out_count == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (block_size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    size_t n = 0U;
+    size_t block = 0U;
+
+    for (size_t base = 0U; base < size; base += block_size, ++block)
+    {
+        size_t end = (size - base < block_size) ? size : base + block_size;
+
+        out_blocks[n] = block;
+        n += (compare_range_differs(a, b, base, end) != 0U);
+    }
+
+    *out_count = n;
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Checksum quick-reject
+// -----------------------------
+
+/**
+ * @brief Computes a 64-bit order-sensitive checksum for quick inequality tests.
+ *
+ * Combines the plain sum and the position-weighted sum `sum(x[i] * (2i + 1))` (both mod 2^64).
+ * Equal arrays always give equal checksums; a checksum match alone does not prove equality.
+ *
+ * @param array        Input array.
+ * @param size         Number of elements.
+ * @param out_checksum Pointer where the checksum will be stored.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_checksum(const int32_t* array, size_t size,
+                                            uint64_t* out_checksum)
+{
+    if (array == NULL || out_checksum == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    uint64_t sum = 0U;
+    uint64_t weighted = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        uint64_t value = (uint32_t) array[i];
+        sum += value;
+        weighted += value * (2U * (uint64_t) i + 1U);
+    }
+
+    *out_checksum = sum ^ (weighted * 0x9E3779B97F4A7C15U) ^ (uint64_t) size;
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Equality test that first compares precomputed checksums.
+ *
+ * @param a          First array.
+ * @param a_checksum `array_checksum()` of `a`.
+ * @param b          Second array.
+ * @param b_checksum `array_checksum()` of `b`.
+ * @param size       Number of elements in each array.
+ * @param out_equal  Pointer where the result will be stored.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_equal_checksum(const int32_t* a, uint64_t a_checksum,
+                                                  const int32_t* b, uint64_t b_checksum,
+                                                  size_t size, bool* out_equal)
+{
+    array_status_t status = compare_check(a, b, size, out_equal);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    if (a_checksum != b_checksum)
+    {
+        *out_equal = false;
+        return ARRAY_STATUS_OK;
+    }
+
+    return array_equal(a, b, size, out_equal);
+}
+
+#endif // ARRAY_COMPARE_H
@@ -0,0 +1,556 @@
+/**
+ * @file array_convert.h
+ * @brief Saturating narrowing / widening conversions between integer array widths.
+ *
+ * Narrowing kernels (PACKSSDW / PACKUSWB semantics) saturate every element to the destination
+ * range and return ARRAY_STATUS_WARNING_OVERFLOW_CLAMP if any element did not fit. Widening
+ * kernels are exact. Typical use: store data clamped with `array_clamp()` to CLAMP_INT16 or
+ * CLAMP_UINT8 at its real width.
+ *
+ * @warning `src` and `dst` must not overlap.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_CONVERT_H
+#define ARRAY_CONVERT_H
+
+#include "array_transform.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------
+//   Helpers
+// -----------------------------
+
+/**
+ * @brief Validates the common arguments of all conversion kernels.
+ */
+static inline array_status_t convert_check(const void* src, const void* dst, size_t size)
+{
+    if (src == NULL || dst == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Narrowing (saturating)
+// -----------------------------
+
+/**
+ * @brief Saturating conversion int32 to int16 (PACKSSDW).
+ *
+ * @param src  Input array.
+ * @param dst  Output array.
+ * @param size Number of elements.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements fit the destination type.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more elements were saturated.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_pack_i32_to_i16(const int32_t* src, int16_t* dst, size_t size)
+{
+    array_status_t status = convert_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        int32_t value = src[i];
+        clamped |= (uint32_t) ((value < INT16_MIN) | (value > INT16_MAX));
+        value = (value < INT16_MIN) ? INT16_MIN : value;
+        value = (value > INT16_MAX) ? INT16_MAX : value;
+        dst[i] = (int16_t) value;
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Saturating conversion int32 to int8.
+ *
+ * @param src  Input array.
+ * @param dst  Output array.
+ * @param size Number of elements.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements fit the destination type.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more elements were saturated.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_pack_i32_to_i8(const int32_t* src, int8_t* dst, size_t size)
+{
+    array_status_t status = convert_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        int32_t value = src[i];
+        clamped |= (uint32_t) ((value < INT8_MIN) | (value > INT8_MAX));
+        value = (value < INT8_MIN) ? INT8_MIN : value;
+        value = (value > INT8_MAX) ? INT8_MAX : value;
+        dst[i] = (int8_t) value;
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Saturating conversion int16 to int8 (PACKSSWB).
+ *
+ * @param src  Input array.
+ * @param dst  Output array.
+ * @param size Number of elements.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements fit the destination type.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more elements were saturated.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_pack_i16_to_i8(const int16_t* src, int8_t* dst, size_t size)
+{
+    array_status_t status = convert_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        int16_t value = src[i];
+        clamped |= (uint32_t) ((value < INT8_MIN) | (value > INT8_MAX));
+        value = (value < INT8_MIN) ? INT8_MIN : value;
+        value = (value > INT8_MAX) ? INT8_MAX : value;
+        dst[i] = (int8_t) value;
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Saturating conversion int32 to uint16 (PACKUSDW).
+ *
+ * @param src  Input array.
+ * @param dst  Output array.
+ * @param size Number of elements.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements fit the destination type.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more elements were saturated.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_pack_i32_to_u16(const int32_t* src, uint16_t* dst, size_t size)
+{
+    array_status_t status = convert_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        int32_t value = src[i];
+        clamped |= (uint32_t) ((value < 0) | (value > UINT16_MAX));
+        value = (value < 0) ? 0 : value;
+        value = (value > UINT16_MAX) ? UINT16_MAX : value;
+        dst[i] = (uint16_t) value;
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Saturating conversion int16 to uint8 (PACKUSWB).
+ *
+ * @param src  Input array.
+ * @param dst  Output array.
+ * @param size Number of elements.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements fit the destination type.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more elements were saturated.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_pack_i16_to_u8(const int16_t* src, uint8_t* dst, size_t size)
+{
+    array_status_t status = convert_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        int16_t value = src[i];
+        clamped |= (uint32_t) ((value < 0) | (value > UINT8_MAX));
+        value = (value < 0) ? 0 : value;
+        value = (value > UINT8_MAX) ? UINT8_MAX : value;
+        dst[i] = (uint8_t) value;
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Saturating conversion uint32 to uint16.
+ *
+ * @param src  Input array.
+ * @param dst  Output array.
+ * @param size Number of elements.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements fit the destination type.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more elements were saturated.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_pack_u32_to_u16(const uint32_t* src, uint16_t* dst, size_t size)
+{
+    array_status_t status = convert_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        uint32_t value = src[i];
+        clamped |= (uint32_t) (value > UINT16_MAX);
+        value = (value > UINT16_MAX) ? UINT16_MAX : value;
+        dst[i] = (uint16_t) value;
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Saturating conversion uint32 to uint8.
+ *
+ * @param src  Input array.
+ * @param dst  Output array.
+ * @param size Number of elements.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements fit the destination type.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more elements were saturated.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_pack_u32_to_u8(const uint32_t* src, uint8_t* dst, size_t size)
+{
+    array_status_t status = convert_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        uint32_t value = src[i];
+        clamped |= (uint32_t) (value > UINT8_MAX);
+        value = (value > UINT8_MAX) ? UINT8_MAX : value;
+        dst[i] = (uint8_t) value;
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Saturating conversion uint16 to uint8.
+ *
+ * @param src  Input array.
+ * @param dst  Output array.
+ * @param size Number of elements.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements fit the destination type.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more elements were saturated.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_pack_u16_to_u8(const uint16_t* src, uint8_t* dst, size_t size)
+{
+    array_status_t status = convert_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        uint16_t value = src[i];
+        clamped |= (uint32_t) (value > UINT8_MAX);
+        value = (value > UINT8_MAX) ? UINT8_MAX : value;
+        dst[i] = (uint8_t) value;
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Signed <-> unsigned (saturating)
+// -----------------------------
+
+/**
+ * @brief Saturating conversion int32 to uint32 (negatives become 0).
+ *
+ * @param src  Input array.
+ * @param dst  Output array.
+ * @param size Number of elements.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements fit the destination type.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more elements were saturated.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_convert_i32_to_u32(const int32_t* src, uint32_t* dst,
+                                                      size_t size)
+{
+    array_status_t status = convert_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        int32_t value = src[i];
+        clamped |= (uint32_t) (value < 0);
+        value = (value < 0) ? 0 : value;
+        dst[i] = (uint32_t) value;
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Saturating conversion uint32 to int32 (values above INT32_MAX saturate).
+ *
+ * @param src  Input array.
+ * @param dst  Output array.
+ * @param size Number of elements.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements fit the destination type.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more elements were saturated.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_convert_u32_to_i32(const uint32_t* src, int32_t* dst,
+                                                      size_t size)
+{
+    array_status_t status = convert_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        uint32_t value = src[i];
+        clamped |= (uint32_t) (value > INT32_MAX);
+        value = (value > INT32_MAX) ? INT32_MAX : value;
+        dst[i] = (int32_t) value;
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Widening (exact)
+// -----------------------------
+
+/**
+ * @brief Exact widening conversion int16 to int32.
+ *
+ * @param src  Input array.
+ * @param dst  Output array.
+ * @param size Number of elements.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_unpack_i16_to_i32(const int16_t* src, int32_t* dst, size_t size)
+{
+    array_status_t status = convert_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        dst[i] = src[i];
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Exact widening conversion int8 to int32.
+ *
+ * @param src  Input array.
+ * @param dst  Output array.
+ * @param size Number of elements.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_unpack_i8_to_i32(const int8_t* src, int32_t* dst, size_t size)
+{
+    array_status_t status = convert_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        dst[i] = src[i];
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Exact widening conversion int8 to int16.
+ *
+ * @param src  Input array.
+ * @param dst  Output array.
+ * @param size Number of elements.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_unpack_i8_to_i16(const int8_t* src, int16_t* dst, size_t size)
+{
+    array_status_t status = convert_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        dst[i] = src[i];
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Exact widening conversion uint16 to uint32.
+ *
+ * @param src  Input array.
+ * @param dst  Output array.
+ * @param size Number of elements.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_unpack_u16_to_u32(const uint16_t* src, uint32_t* dst,
+                                                     size_t size)
+{
+    array_status_t status = convert_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        dst[i] = src[i];
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Exact widening conversion uint8 to uint32.
+ *
+ * @param src  Input array.
+ * @param dst  Output array.
+ * @param size Number of elements.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_unpack_u8_to_u32(const uint8_t* src, uint32_t* dst, size_t size)
+{
+    array_status_t status = convert_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        dst[i] = src[i];
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Exact widening conversion uint8 to uint16.
+ *
+ * @param src  Input array.
+ * @param dst  Output array.
+ * @param size Number of elements.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_unpack_u8_to_u16(const uint8_t* src, uint16_t* dst, size_t size)
+{
+    array_status_t status = convert_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        dst[i] = src[i];
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+#endif // ARRAY_CONVERT_H
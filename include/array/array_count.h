@@ -0,0 +1,276 @@
+/**
+ * @file array_count.h
+ * @brief Branch-free predicate counting and any / all tests with early exit.
+ *
+ * Counting sums the 0/1 result of the predicate instead of branching on it, so the loops
+ * vectorize into compare + add. Per-block counts are kept in 32-bit lanes and added to the
+ * total once per block. `array_any()` / `array_all()` evaluate a whole block without branching
+ * and stop after the first block that decides the answer.
+ *
+ * Predicates are the `filter_pred_t` ones from `array_filter.h`.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_COUNT_H
+#define ARRAY_COUNT_H
+
+#include "array_filter.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------
+//   Configuration
+// -----------------------------
+
+/** Elements per block: one 32-bit partial count, one early-exit check. */
+#define COUNT_BLOCK 256U
+
+// -----------------------------
+//   Helpers
+// -----------------------------
+
+/**
+ * @brief Counts matching elements; `pred` is a constant at every call site.
+ */
+static inline size_t count_matches(const int32_t* array, size_t size, filter_pred_t pred,
+                                   int32_t a, int32_t b)
+{
+    size_t total = 0U;
+
+    for (size_t base = 0U; base < size; base += COUNT_BLOCK)
+    {
+        size_t end = (size - base < COUNT_BLOCK) ? size : base + COUNT_BLOCK;
+        uint32_t block = 0U;
+
+        for (size_t i = base; i < end; ++i)
+        {
+            block += filter_match(array[i], pred, a, b);
+        }
+
+        total += block;
+    }
+
+    return total;
+}
+
+/**
+ * @brief Returns true if some element's predicate result equals `target` (0 or 1).
+ */
+static inline bool count_exists(const int32_t* array, size_t size, filter_pred_t pred, int32_t a,
+                                int32_t b, uint32_t target)
+{
+    for (size_t base = 0U; base < size; base += COUNT_BLOCK)
+    {
+        size_t end = (size - base < COUNT_BLOCK) ? size : base + COUNT_BLOCK;
+        uint32_t hit = 0U;
+
+        for (size_t i = base; i < end; ++i)
+        {
+            hit |= filter_match(array[i], pred, a, b) ^ target ^ 1U;
+        }
+
+        if (hit)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Dispatches `count_exists()` to a loop specialized for `pred`.
+ */
+static inline bool count_exists_dispatch(const int32_t* array, size_t size, filter_pred_t pred,
+                                         int32_t a, int32_t b, uint32_t target)
+{
+    switch (pred)
+    {
+    case FILTER_PRED_IN_RANGE:
+        return count_exists(array, size, FILTER_PRED_IN_RANGE, a, b, target);
+    case FILTER_PRED_GT:
+        return count_exists(array, size, FILTER_PRED_GT, a, b, target);
+    case FILTER_PRED_LT:
+        return count_exists(array, size, FILTER_PRED_LT, a, b, target);
+    case FILTER_PRED_EQ:
+        return count_exists(array, size, FILTER_PRED_EQ, a, b, target);
+    default:
+        return count_exists(array, size, FILTER_PRED_NE, a, b, target);
+    }
+}
+
+/**
+ * @brief Validates the common arguments of all counting kernels.
+ */
+static inline array_status_t count_check(const int32_t* array, size_t size, const void* out,
+                                         filter_pred_t pred, int32_t a, int32_t b)
+{
+    if (array == NULL || out == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if ((unsigned) pred > (unsigned) FILTER_PRED_NE || (pred == FILTER_PRED_IN_RANGE && a > b))
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Counting
+// -----------------------------
+
+/**
+ * @brief Counts the elements with lo <= x <= hi.
+ *
+ * @param array     Input array.
+ * @param size      Number of elements.
+ * @param lo        Lower bound (inclusive).
+ * @param hi        Upper bound (inclusive).
+ * @param out_count Pointer where the count will be stored.
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT lo > hi.
+ */
+static inline array_status_t array_count_in_range(const int32_t* array, size_t size, int32_t lo,
+                                                  int32_t hi, size_t* out_count)
+{
+    array_status_t status = count_check(array, size, out_count, FILTER_PRED_IN_RANGE, lo, hi);
+    if (status == ARRAY_STATUS_OK)
+    {
+        *out_count = count_matches(array, size, FILTER_PRED_IN_RANGE, lo, hi);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Counts the elements with x > value.
+ *
+ * @param array     Input array.
+ * @param size      Number of elements.
+ * @param value     Threshold.
+ * @param out_count Pointer where the count will be stored.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_count_gt(const int32_t* array, size_t size, int32_t value,
+                                            size_t* out_count)
+{
+    array_status_t status = count_check(array, size, out_count, FILTER_PRED_GT, value, 0);
+    if (status == ARRAY_STATUS_OK)
+    {
+        *out_count = count_matches(array, size, FILTER_PRED_GT, value, 0);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Counts the elements with x < value.
+ *
+ * @see array_count_gt()
+ */
+static inline array_status_t array_count_lt(const int32_t* array, size_t size, int32_t value,
+                                            size_t* out_count)
+{
+    array_status_t status = count_check(array, size, out_count, FILTER_PRED_LT, value, 0);
+    if (status == ARRAY_STATUS_OK)
+    {
+        *out_count = count_matches(array, size, FILTER_PRED_LT, value, 0);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Counts the elements with x == value.
+ *
+ * @see array_count_gt()
+ */
+static inline array_status_t array_count_eq(const int32_t* array, size_t size, int32_t value,
+                                            size_t* out_count)
+{
+    array_status_t status = count_check(array, size, out_count, FILTER_PRED_EQ, value, 0);
+    if (status == ARRAY_STATUS_OK)
+    {
+        *out_count = count_matches(array, size, FILTER_PRED_EQ, value, 0);
+    }
+
+    return status;
+}
+
+// -----------------------------
+//   Any / all
+// -----------------------------
+
+/**
+ * @brief Tests whether at least one element matches a predicate (stops at the first block
+ *        containing a match).
+ *
+ * @param array   Input array.
+ * @param size    Number of elements.
+ * @param pred    Predicate.
+ * @param a       First operand (lower bound or threshold).
+ * @param b       Second operand (upper bound for FILTER_PRED_IN_RANGE, ignored otherwise).
+ * @param out_any Pointer where the result will be stored.
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT Unknown predicate or a > b for a range.
+ */
+static inline array_status_t array_any(const int32_t* array, size_t size, filter_pred_t pred,
+                                       int32_t a, int32_t b, bool* out_any)
+{
+    array_status_t status = count_check(array, size, out_any, pred, a, b);
+    if (status == ARRAY_STATUS_OK)
+    {
+        *out_any = count_exists_dispatch(array, size, pred, a, b, 1U);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Tests whether every element matches a predicate (stops at the first block
+ *        containing a non-match).
+ *
+ * @param array   Input array.
+ * @param size    Number of elements.
+ * @param pred    Predicate.
+ * @param a       First operand (lower bound or threshold).
+ * @param b       Second operand (upper bound for FILTER_PRED_IN_RANGE, ignored otherwise).
+ * @param out_all Pointer where the result will be stored.
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT Unknown predicate or a > b for a range.
+ */
+static inline array_status_t array_all(const int32_t* array, size_t size, filter_pred_t pred,
+                                       int32_t a, int32_t b, bool* out_all)
+{
+    array_status_t status = count_check(array, size, out_all, pred, a, b);
+    if (status == ARRAY_STATUS_OK)
+    {
+        *out_all = !count_exists_dispatch(array, size, pred, a, b, 0U);
+    }
+
+    return status;
+}
+
+#endif // ARRAY_COUNT_H
@@ -0,0 +1,345 @@
+/**
+ * @file array_delta.h
+ * @brief Delta, delta-of-delta and zigzag-delta encoding of int32 arrays.
+ *
+ * Slowly changing signals encode to small deltas that compress well. All arithmetic is done
+ * modulo 2^32, so every encode / decode pair is lossless for the full int32 range (a delta that
+ * does not fit in int32 simply wraps and wraps back on decode).
+ *
+ * Every kernel takes the value(s) preceding the first element (`prev`), so long signals can be
+ * processed chunk by chunk: pass the last decoded value of the previous chunk, or 0 for the
+ * first one. `dst` may be the same pointer as `src` (in-place); partial overlap is not allowed.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_DELTA_H
+#define ARRAY_DELTA_H
+
+#include "array_transform.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------
+//   Helpers
+// -----------------------------
+
+/**
+ * @brief Validates the common arguments of all delta kernels.
+ */
+static inline array_status_t delta_check(const void* src, const void* dst, size_t size)
+{
+    if (src == NULL || dst == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Maps a signed value to unsigned so that small magnitudes give small codes
+ *        (0, -1, 1, -2, ... -> 0, 1, 2, 3, ...).
+ */
+static inline uint32_t zigzag_encode(uint32_t value)
+{
+    return (value << 1) ^ (0U - (value >> 31));
+}
+
+/**
+ * @brief Inverse of `zigzag_encode()`.
+ */
+static inline uint32_t zigzag_decode(uint32_t code)
+{
+    return (code >> 1) ^ (0U - (code & 1U));
+}
+
+// -----------------------------
+//   Delta
+// -----------------------------
+
+/**
+ * @brief Replaces each element by its difference to the previous one.
+ *
+ * `dst[i] = src[i] - src[i - 1]`, with `src[-1] = prev`. This loop has no dependency between
+ * iterations and vectorizes.
+ *
+ * @param src  Input array.
+ * @param dst  Output array (may equal `src`).
+ * @param size Number of elements.
+ * @param prev Value preceding `src[0]` (0 for a standalone array).
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_delta_encode(const int32_t* src, int32_t* dst, size_t size,
+                                                int32_t prev)
+{
+    array_status_t status = delta_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t last = (uint32_t) prev;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        uint32_t value = (uint32_t) src[i];
+        dst[i] = (int32_t) (value - last);
+        last = value;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Restores the original values from deltas (running prefix sum).
+ *
+ * The prefix sum is a single add per element on the critical path and is limited by memory
+ * bandwidth rather than by the dependency chain.
+ *
+ * @param src  Delta array.
+ * @param dst  Output array (may equal `src`).
+ * @param size Number of elements.
+ * @param prev Value preceding the first element (same as passed to the encoder).
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_delta_decode(const int32_t* src, int32_t* dst, size_t size,
+                                                int32_t prev)
+{
+    array_status_t status = delta_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t acc = (uint32_t) prev;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        acc += (uint32_t) src[i];
+        dst[i] = (int32_t) acc;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Decodes deltas and computes min, max and sum of the decoded values in the same pass.
+ *
+ * Reading a delta-encoded frame and computing its statistics costs a single pass over memory,
+ * instead of a decode pass followed by separate `array_min()` / `array_max()` / `array_sum()`.
+ *
+ * @param src     Delta array.
+ * @param dst     Output array (may equal `src`).
+ * @param size    Number of elements.
+ * @param prev    Value preceding the first element.
+ * @param out_min Optional pointer for the minimum decoded value (may be NULL).
+ * @param out_max Optional pointer for the maximum decoded value (may be NULL).
+ * @param out_sum Optional pointer for the sum of decoded values (may be NULL).
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_delta_decode_stats(const int32_t* src, int32_t* dst,
+                                                      size_t size, int32_t prev,
+                                                      int32_t* out_min, int32_t* out_max,
+                                                      int64_t* out_sum)
+{
+    array_status_t status = delta_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t acc = (uint32_t) prev;
+    int32_t min = INT32_MAX;
+    int32_t max = INT32_MIN;
+    int64_t sum = 0;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        acc += (uint32_t) src[i];
+        int32_t value = (int32_t) acc;
+        dst[i] = value;
+
+        min = (value < min) ? value : min;
+        max = (value > max) ? value : max;
+        sum += value;
+    }
+
+    if (out_min != NULL)
+    {
+        *out_min = min;
+    }
+    if (out_max != NULL)
+    {
+        *out_max = max;
+    }
+    if (out_sum != NULL)
+    {
+        *out_sum = sum;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Delta-of-delta
+// -----------------------------
+
+/**
+ * @brief Second-order delta: `dst[i] = d[i] - d[i - 1]` with `d[i] = src[i] - src[i - 1]`.
+ *
+ * Signals with a near-constant slope (timestamps, ramps) encode to values close to 0.
+ *
+ * @param src        Input array.
+ * @param dst        Output array (may equal `src`).
+ * @param size       Number of elements.
+ * @param prev       Value preceding `src[0]`.
+ * @param prev_delta Delta preceding `src[0]` (`src[-1] - src[-2]`, 0 for a standalone array).
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_delta2_encode(const int32_t* src, int32_t* dst, size_t size,
+                                                 int32_t prev, int32_t prev_delta)
+{
+    array_status_t status = delta_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t last = (uint32_t) prev;
+    uint32_t last_delta = (uint32_t) prev_delta;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        uint32_t value = (uint32_t) src[i];
+        uint32_t delta = value - last;
+        dst[i] = (int32_t) (delta - last_delta);
+        last = value;
+        last_delta = delta;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Inverse of `array_delta2_encode()` (two chained prefix sums in one pass).
+ *
+ * @param src        Delta-of-delta array.
+ * @param dst        Output array (may equal `src`).
+ * @param size       Number of elements.
+ * @param prev       Value preceding the first element.
+ * @param prev_delta Delta preceding the first element.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_delta2_decode(const int32_t* src, int32_t* dst, size_t size,
+                                                 int32_t prev, int32_t prev_delta)
+{
+    array_status_t status = delta_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t acc = (uint32_t) prev;
+    uint32_t delta = (uint32_t) prev_delta;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        delta += (uint32_t) src[i];
+        acc += delta;
+        dst[i] = (int32_t) acc;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Zigzag delta
+// -----------------------------
+
+/**
+ * @brief Delta encoding followed by zigzag mapping, ready for varint / bit packing.
+ *
+ * @param src  Input array.
+ * @param dst  Output codes (may alias `src`).
+ * @param size Number of elements.
+ * @param prev Value preceding `src[0]`.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_zigzag_delta_encode(const int32_t* src, uint32_t* dst,
+                                                       size_t size, int32_t prev)
+{
+    array_status_t status = delta_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t last = (uint32_t) prev;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        uint32_t value = (uint32_t) src[i];
+        dst[i] = zigzag_encode(value - last);
+        last = value;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Inverse of `array_zigzag_delta_encode()`.
+ *
+ * @param src  Zigzag delta codes.
+ * @param dst  Output array (may alias `src`).
+ * @param size Number of elements.
+ * @param prev Value preceding the first element.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_zigzag_delta_decode(const uint32_t* src, int32_t* dst,
+                                                       size_t size, int32_t prev)
+{
+    array_status_t status = delta_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t acc = (uint32_t) prev;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        acc += zigzag_decode(src[i]);
+        dst[i] = (int32_t) acc;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+#endif // ARRAY_DELTA_H
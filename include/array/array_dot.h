@@ -0,0 +1,274 @@
+/**
+ * @file array_dot.h
+ * @brief Dot product / multiply-accumulate kernels with int64 accumulation.
+ *
+ * All kernels accumulate into several independent partial sums (breaking the add dependency
+ * chain) and report ARRAY_STATUS_WARNING_OVERFLOW_CLAMP if the exact result does not fit in an
+ * `int64_t`, in which case the output saturates to INT64_MIN / INT64_MAX.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_DOT_H
+#define ARRAY_DOT_H
+
+#include "array_transform.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** Number of independent accumulators used by the unrolled loops. */
+#define DOT_ACCUMULATORS 4U
+
+/** Elements per block of `array_dot_i32()` (low halves < 2^32 each, summed in uint64). */
+#define DOT_I32_BLOCK ((size_t) 1U << 31)
+
+/** Elements per int64 block of `array_dot_i16()` (|block sum| <= 2^30 * 2^31 = 2^61). */
+#define DOT_I16_BLOCK ((size_t) 1U << 31)
+
+/** Elements per int32 block of `array_dot_u8i8()` (255 * 128 * 65536 < INT32_MAX). */
+#define DOT_U8I8_BLOCK ((size_t) 1U << 16)
+
+// -----------------------------
+//   Helpers
+// -----------------------------
+
+/**
+ * @brief Adds a block sum to a running total, saturating on int64 overflow.
+ */
+static inline void dot_accumulate(int64_t* total, int64_t block, bool* overflow)
+{
+    if (block > 0 && *total > INT64_MAX - block)
+    {
+        *total = INT64_MAX;
+        *overflow = true;
+    }
+    else if (block < 0 && *total < INT64_MIN - block)
+    {
+        *total = INT64_MIN;
+        *overflow = true;
+    }
+    else
+    {
+        *total += block;
+    }
+}
+
+/**
+ * @brief Validates the common arguments of all dot kernels.
+ */
+static inline array_status_t dot_check(const void* a, const void* b, const int64_t* out,
+                                       size_t size)
+{
+    if (a == NULL || b == NULL || out == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Kernels
+// -----------------------------
+
+/**
+ * @brief Dot product of two int32 arrays with exact int64 result.
+ *
+ * Each 64-bit product is split into a signed high half and an unsigned low half, accumulated
+ * separately so no partial sum can overflow; the halves are recombined once at the end.
+ *
+ * @note Relies on arithmetic right shift of negative `int64_t` values.
+ *
+ * @param a       First input array.
+ * @param b       Second input array.
+ * @param size    Number of elements in each array.
+ * @param out_dot Pointer where the dot product will be stored.
+ *
+ * @retval ARRAY_STATUS_OK                     Exact result stored.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP Result exceeded int64 and was saturated.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_dot_i32(const int32_t* a, const int32_t* b, size_t size,
+                                           int64_t* out_dot)
+{
+    array_status_t status = dot_check(a, b, out_dot, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    int64_t hi_sum = 0;
+    uint64_t lo_sum = 0U;
+    size_t i = 0U;
+
+    while (i < size)
+    {
+        // Bound each block so the low halves cannot overflow uint64_t
+        size_t block_end = (size - i > DOT_I32_BLOCK) ? i + DOT_I32_BLOCK : size;
+        int64_t hi[DOT_ACCUMULATORS] = {0, 0, 0, 0};
+        uint64_t lo[DOT_ACCUMULATORS] = {0U, 0U, 0U, 0U};
+
+        for (; i + DOT_ACCUMULATORS <= block_end; i += DOT_ACCUMULATORS)
+        {
+            for (size_t k = 0U; k < DOT_ACCUMULATORS; ++k)
+            {
+                int64_t p = (int64_t) a[i + k] * b[i + k];
+                hi[k] += p >> 32;
+                lo[k] += (uint64_t) p & 0xFFFFFFFFU;
+            }
+        }
+
+        for (; i < block_end; ++i)
+        {
+            int64_t p = (int64_t) a[i] * b[i];
+            hi[0] += p >> 32;
+            lo[0] += (uint64_t) p & 0xFFFFFFFFU;
+        }
+
+        for (size_t k = 0U; k < DOT_ACCUMULATORS; ++k)
+        {
+            // Normalize each partial so the low part stays below 2^32
+            hi_sum += hi[k] + (int64_t) (lo[k] >> 32);
+            lo_sum += lo[k] & 0xFFFFFFFFU;
+        }
+
+        hi_sum += (int64_t) (lo_sum >> 32);
+        lo_sum &= 0xFFFFFFFFU;
+    }
+
+    if (hi_sum > INT32_MAX)
+    {
+        *out_dot = INT64_MAX;
+        return ARRAY_STATUS_WARNING_OVERFLOW_CLAMP;
+    }
+
+    if (hi_sum < INT32_MIN)
+    {
+        *out_dot = INT64_MIN;
+        return ARRAY_STATUS_WARNING_OVERFLOW_CLAMP;
+    }
+
+    *out_dot = hi_sum * ((int64_t) 1 << 32) + (int64_t) lo_sum;
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Dot product of two int16 arrays.
+ *
+ * Products fit in 32 bits and adjacent pairs are summed before widening (PMADDWD-style); each
+ * block of `DOT_I16_BLOCK` elements is summed in int64 without overflow checks.
+ *
+ * @param a       First input array.
+ * @param b       Second input array.
+ * @param size    Number of elements in each array.
+ * @param out_dot Pointer where the dot product will be stored.
+ *
+ * @retval ARRAY_STATUS_OK                     Exact result stored.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP Result exceeded int64 and was saturated.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_dot_i16(const int16_t* a, const int16_t* b, size_t size,
+                                           int64_t* out_dot)
+{
+    array_status_t status = dot_check(a, b, out_dot, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    int64_t total = 0;
+    bool overflow = false;
+    size_t i = 0U;
+
+    while (i < size)
+    {
+        size_t block_end = (size - i > DOT_I16_BLOCK) ? i + DOT_I16_BLOCK : size;
+        int64_t acc[DOT_ACCUMULATORS] = {0, 0, 0, 0};
+
+        for (; i + 2U * DOT_ACCUMULATORS <= block_end; i += 2U * DOT_ACCUMULATORS)
+        {
+            for (size_t k = 0U; k < DOT_ACCUMULATORS; ++k)
+            {
+                // Pair sum is at most 2^31 in magnitude: widen before adding
+                int64_t pair = (int64_t) ((int32_t) a[i + 2U * k] * b[i + 2U * k]) +
+                               (int32_t) a[i + 2U * k + 1U] * b[i + 2U * k + 1U];
+                acc[k] += pair;
+            }
+        }
+
+        for (; i < block_end; ++i)
+        {
+            acc[0] += (int32_t) a[i] * b[i];
+        }
+
+        dot_accumulate(&total, (acc[0] + acc[1]) + (acc[2] + acc[3]), &overflow);
+    }
+
+    *out_dot = total;
+    return overflow ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Dot product of a uint8 array with an int8 array (quantized data).
+ *
+ * Products fit in 16 bits and are accumulated in int32 for blocks of `DOT_U8I8_BLOCK` elements
+ * before being widened to int64.
+ *
+ * @param a       Unsigned input array (e.g. activations).
+ * @param b       Signed input array (e.g. weights).
+ * @param size    Number of elements in each array.
+ * @param out_dot Pointer where the dot product will be stored.
+ *
+ * @retval ARRAY_STATUS_OK                     Exact result stored.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP Result exceeded int64 and was saturated.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_dot_u8i8(const uint8_t* a, const int8_t* b, size_t size,
+                                            int64_t* out_dot)
+{
+    array_status_t status = dot_check(a, b, out_dot, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    int64_t total = 0;
+    bool overflow = false;
+    size_t i = 0U;
+
+    while (i < size)
+    {
+        size_t block_end = (size - i > DOT_U8I8_BLOCK) ? i + DOT_U8I8_BLOCK : size;
+        int32_t acc[DOT_ACCUMULATORS] = {0, 0, 0, 0};
+
+        for (; i + DOT_ACCUMULATORS <= block_end; i += DOT_ACCUMULATORS)
+        {
+            for (size_t k = 0U; k < DOT_ACCUMULATORS; ++k)
+            {
+                acc[k] += (int32_t) a[i + k] * b[i + k];
+            }
+        }
+
+        for (; i < block_end; ++i)
+        {
+            acc[0] += (int32_t) a[i] * b[i];
+        }
+
+        int64_t block = (int64_t) acc[0] + acc[1] + acc[2] + acc[3];
+        dot_accumulate(&total, block, &overflow);
+    }
+
+    *out_dot = total;
+    return overflow ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+#endif // ARRAY_DOT_H
@@ -0,0 +1,559 @@
+/**
+ * @file array_elementwise.h
+ * @brief Saturating element-wise binary operations between two arrays (add, sub, mul, ...).
+ *
+ * Every kernel computes `dst[i] = a[i] op b[i]` with a widened intermediate and saturates the
+ * result to the clamp range, using the same semantics as `array_transform.h`. `dst` may alias
+ * `a` or `b` for in-place operation.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_ELEMENTWISE_H
+#define ARRAY_ELEMENTWISE_H
+
+#include "array_transform.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------
+//   Type Definitions
+// -----------------------------
+
+/**
+ * @brief Element-wise binary operation.
+ */
+typedef enum
+{
+    BINARY_OP_ADD,    /**< a + b */
+    BINARY_OP_SUB,    /**< a - b */
+    BINARY_OP_MUL,    /**< a * b */
+    BINARY_OP_MIN,    /**< min(a, b) */
+    BINARY_OP_MAX,    /**< max(a, b) */
+    BINARY_OP_ABSDIFF /**< |a - b| */
+} binary_op_t;
+
+// -----------------------------
+//   Helpers
+// -----------------------------
+
+/**
+ * @brief Evaluates a binary operation on widened operands (no overflow for 32-bit inputs).
+ *
+ * @note For unsigned 32-bit operands, `BINARY_OP_MUL` can exceed `INT64_MAX` and must be
+ *       handled by the caller.
+ */
+static inline int64_t binary_op_eval(int64_t x, int64_t y, binary_op_t op)
+{
+    switch (op)
+    {
+    case BINARY_OP_ADD:
+        return x + y;
+    case BINARY_OP_SUB:
+        return x - y;
+    case BINARY_OP_MUL:
+        return x * y;
+    case BINARY_OP_MIN:
+        return (x < y) ? x : y;
+    case BINARY_OP_MAX:
+        return (x > y) ? x : y;
+    default:
+        return (x > y) ? x - y : y - x;
+    }
+}
+
+/**
+ * @brief Validates the common arguments of all element-wise kernels.
+ */
+static inline array_status_t binary_op_check(const void* a, const void* b, const void* dst,
+                                             size_t size, binary_op_t op)
+{
+    if (a == NULL || b == NULL || dst == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if ((unsigned) op > (unsigned) BINARY_OP_ABSDIFF)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Loops (one instantiation per operation)
+// -----------------------------
+
+// Each public kernel switches on `op` once and calls its loop with a constant operation, so
+// after inlining every case is a straight-line loop without a per-element dispatch.
+
+/**
+ * @brief int32 loop: dst[i] = clamp(a[i] op b[i], min, max), returns non-zero if anything clamped.
+ */
+static inline uint32_t binary_loop_int32(const int32_t* a, const int32_t* b, int32_t* dst,
+                                         size_t size, binary_op_t op, int64_t min, int64_t max)
+{
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        int64_t result = binary_op_eval(a[i], b[i], op);
+        clamped |= (uint32_t) ((result < min) | (result > max));
+        result = (result < min) ? min : result;
+        result = (result > max) ? max : result;
+        dst[i] = (int32_t) result;
+    }
+
+    return clamped;
+}
+
+/**
+ * @brief uint32 loop: dst[i] = clamp(a[i] op b[i], min, max), returns non-zero if anything clamped.
+ */
+static inline uint32_t binary_loop_uint32(const uint32_t* a, const uint32_t* b, uint32_t* dst,
+                                          size_t size, binary_op_t op, int64_t min, int64_t max)
+{
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        int64_t result = binary_op_eval(a[i], b[i], op);
+        clamped |= (uint32_t) ((result < min) | (result > max));
+        result = (result < min) ? min : result;
+        result = (result > max) ? max : result;
+        dst[i] = (uint32_t) result;
+    }
+
+    return clamped;
+}
+
+/**
+ * @brief int16 loop: dst[i] = clamp(a[i] op b[i], min, max), returns non-zero if anything clamped.
+ */
+static inline uint32_t binary_loop_int16(const int16_t* a, const int16_t* b, int16_t* dst,
+                                         size_t size, binary_op_t op, int64_t min, int64_t max)
+{
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        int64_t result = binary_op_eval(a[i], b[i], op);
+        clamped |= (uint32_t) ((result < min) | (result > max));
+        result = (result < min) ? min : result;
+        result = (result > max) ? max : result;
+        dst[i] = (int16_t) result;
+    }
+
+    return clamped;
+}
+
+/**
+ * @brief uint16 loop: dst[i] = clamp(a[i] op b[i], min, max), returns non-zero if anything clamped.
+ */
+static inline uint32_t binary_loop_uint16(const uint16_t* a, const uint16_t* b, uint16_t* dst,
+                                          size_t size, binary_op_t op, int64_t min, int64_t max)
+{
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        int64_t result = binary_op_eval(a[i], b[i], op);
+        clamped |= (uint32_t) ((result < min) | (result > max));
+        result = (result < min) ? min : result;
+        result = (result > max) ? max : result;
+        dst[i] = (uint16_t) result;
+    }
+
+    return clamped;
+}
+
+/**
+ * @brief int8 loop: dst[i] = clamp(a[i] op b[i], min, max), returns non-zero if anything clamped.
+ */
+static inline uint32_t binary_loop_int8(const int8_t* a, const int8_t* b, int8_t* dst,
+                                        size_t size, binary_op_t op, int64_t min, int64_t max)
+{
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        int64_t result = binary_op_eval(a[i], b[i], op);
+        clamped |= (uint32_t) ((result < min) | (result > max));
+        result = (result < min) ? min : result;
+        result = (result > max) ? max : result;
+        dst[i] = (int8_t) result;
+    }
+
+    return clamped;
+}
+
+/**
+ * @brief uint8 loop: dst[i] = clamp(a[i] op b[i], min, max), returns non-zero if anything clamped.
+ */
+static inline uint32_t binary_loop_uint8(const uint8_t* a, const uint8_t* b, uint8_t* dst,
+                                         size_t size, binary_op_t op, int64_t min, int64_t max)
+{
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        int64_t result = binary_op_eval(a[i], b[i], op);
+        clamped |= (uint32_t) ((result < min) | (result > max));
+        result = (result < min) ? min : result;
+        result = (result > max) ? max : result;
+        dst[i] = (uint8_t) result;
+    }
+
+    return clamped;
+}
+
+/**
+ * @brief uint32 multiply loop; the product is pre-saturated so it fits in int64_t.
+ */
+static inline uint32_t binary_mul_uint32(const uint32_t* a, const uint32_t* b, uint32_t* dst,
+                                         size_t size, int64_t max)
+{
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        uint64_t product = (uint64_t) a[i] * b[i];
+        clamped |= (uint32_t) (product > (uint64_t) max);
+        dst[i] = (product > (uint64_t) max) ? (uint32_t) max : (uint32_t) product;
+    }
+
+    return clamped;
+}
+
+// -----------------------------
+//   32-bit kernels
+// -----------------------------
+
+/**
+ * @brief Saturating element-wise operation on signed 32-bit arrays: dst[i] = a[i] op b[i].
+ *
+ * @param a    First input array.
+ * @param b    Second input array.
+ * @param dst  Output array (may be equal to `a` or `b`).
+ * @param size Number of elements in each array.
+ * @param op   Operation to apply.
+ * @param type Range to clamp against.
+ *
+ * @retval ARRAY_STATUS_OK                     All results were in range.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more results were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    Unknown operation.
+ */
+static inline array_status_t array_binary_int32(const int32_t* a, const int32_t* b, int32_t* dst,
+                                                size_t size, binary_op_t op, clamp_type_int_t type)
+{
+    array_status_t status = binary_op_check(a, b, dst, size, op);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    int32_t min = INT32_MIN;
+    int32_t max = INT32_MAX;
+    clamp_limits_int32(type, &min, &max);
+
+    uint32_t clamped = 0U;
+
+    switch (op)
+    {
+    case BINARY_OP_ADD:
+        clamped = binary_loop_int32(a, b, dst, size, BINARY_OP_ADD, min, max);
+        break;
+    case BINARY_OP_SUB:
+        clamped = binary_loop_int32(a, b, dst, size, BINARY_OP_SUB, min, max);
+        break;
+    case BINARY_OP_MUL:
+        clamped = binary_loop_int32(a, b, dst, size, BINARY_OP_MUL, min, max);
+        break;
+    case BINARY_OP_MIN:
+        clamped = binary_loop_int32(a, b, dst, size, BINARY_OP_MIN, min, max);
+        break;
+    case BINARY_OP_MAX:
+        clamped = binary_loop_int32(a, b, dst, size, BINARY_OP_MAX, min, max);
+        break;
+    default:
+        clamped = binary_loop_int32(a, b, dst, size, BINARY_OP_ABSDIFF, min, max);
+        break;
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Saturating element-wise operation on unsigned 32-bit arrays: dst[i] = a[i] op b[i].
+ *
+ * Subtraction and its underflow saturate at 0.
+ *
+ * @param a    First input array.
+ * @param b    Second input array.
+ * @param dst  Output array (may be equal to `a` or `b`).
+ * @param size Number of elements in each array.
+ * @param op   Operation to apply.
+ * @param type Unsigned integer range to clamp against.
+ *
+ * @retval ARRAY_STATUS_OK                     All results were in range.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more results were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    Unknown operation.
+ */
+static inline array_status_t array_binary_uint32(const uint32_t* a, const uint32_t* b,
+                                                 uint32_t* dst, size_t size, binary_op_t op,
+                                                 clamp_type_uint_t type)
+{
+    array_status_t status = binary_op_check(a, b, dst, size, op);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    const int64_t max = clamp_limit_uint32(type);
+    uint32_t clamped = 0U;
+
+    switch (op)
+    {
+    case BINARY_OP_ADD:
+        clamped = binary_loop_uint32(a, b, dst, size, BINARY_OP_ADD, 0, max);
+        break;
+    case BINARY_OP_SUB:
+        clamped = binary_loop_uint32(a, b, dst, size, BINARY_OP_SUB, 0, max);
+        break;
+    case BINARY_OP_MUL:
+        clamped = binary_mul_uint32(a, b, dst, size, max);
+        break;
+    case BINARY_OP_MIN:
+        clamped = binary_loop_uint32(a, b, dst, size, BINARY_OP_MIN, 0, max);
+        break;
+    case BINARY_OP_MAX:
+        clamped = binary_loop_uint32(a, b, dst, size, BINARY_OP_MAX, 0, max);
+        break;
+    default:
+        clamped = binary_loop_uint32(a, b, dst, size, BINARY_OP_ABSDIFF, 0, max);
+        break;
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Narrow kernels (saturate to the element type)
+// -----------------------------
+
+/**
+ * @brief Saturating element-wise operation on int16 arrays (CLAMP_INT16 semantics).
+ *
+ * @param a    First input array.
+ * @param b    Second input array.
+ * @param dst  Output array (may be equal to `a` or `b`).
+ * @param size Number of elements in each array.
+ * @param op   Operation to apply.
+ *
+ * @retval ARRAY_STATUS_OK                     All results were in range.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more results were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    Unknown operation.
+ */
+static inline array_status_t array_binary_int16(const int16_t* a, const int16_t* b, int16_t* dst,
+                                                size_t size, binary_op_t op)
+{
+    array_status_t status = binary_op_check(a, b, dst, size, op);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t clamped = 0U;
+
+    switch (op)
+    {
+    case BINARY_OP_ADD:
+        clamped = binary_loop_int16(a, b, dst, size, BINARY_OP_ADD, INT16_MIN, INT16_MAX);
+        break;
+    case BINARY_OP_SUB:
+        clamped = binary_loop_int16(a, b, dst, size, BINARY_OP_SUB, INT16_MIN, INT16_MAX);
+        break;
+    case BINARY_OP_MUL:
+        clamped = binary_loop_int16(a, b, dst, size, BINARY_OP_MUL, INT16_MIN, INT16_MAX);
+        break;
+    case BINARY_OP_MIN:
+        clamped = binary_loop_int16(a, b, dst, size, BINARY_OP_MIN, INT16_MIN, INT16_MAX);
+        break;
+    case BINARY_OP_MAX:
+        clamped = binary_loop_int16(a, b, dst, size, BINARY_OP_MAX, INT16_MIN, INT16_MAX);
+        break;
+    default:
+        clamped = binary_loop_int16(a, b, dst, size, BINARY_OP_ABSDIFF, INT16_MIN, INT16_MAX);
+        break;
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Saturating element-wise operation on uint16 arrays (CLAMP_UINT16 semantics).
+ *
+ * @param a    First input array.
+ * @param b    Second input array.
+ * @param dst  Output array (may be equal to `a` or `b`).
+ * @param size Number of elements in each array.
+ * @param op   Operation to apply.
+ *
+ * @retval ARRAY_STATUS_OK                     All results were in range.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more results were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    Unknown operation.
+ */
+static inline array_status_t array_binary_uint16(const uint16_t* a, const uint16_t* b,
+                                                 uint16_t* dst, size_t size, binary_op_t op)
+{
+    array_status_t status = binary_op_check(a, b, dst, size, op);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t clamped = 0U;
+
+    switch (op)
+    {
+    case BINARY_OP_ADD:
+        clamped = binary_loop_uint16(a, b, dst, size, BINARY_OP_ADD, 0, UINT16_MAX);
+        break;
+    case BINARY_OP_SUB:
+        clamped = binary_loop_uint16(a, b, dst, size, BINARY_OP_SUB, 0, UINT16_MAX);
+        break;
+    case BINARY_OP_MUL:
+        clamped = binary_loop_uint16(a, b, dst, size, BINARY_OP_MUL, 0, UINT16_MAX);
+        break;
+    case BINARY_OP_MIN:
+        clamped = binary_loop_uint16(a, b, dst, size, BINARY_OP_MIN, 0, UINT16_MAX);
+        break;
+    case BINARY_OP_MAX:
+        clamped = binary_loop_uint16(a, b, dst, size, BINARY_OP_MAX, 0, UINT16_MAX);
+        break;
+    default:
+        clamped = binary_loop_uint16(a, b, dst, size, BINARY_OP_ABSDIFF, 0, UINT16_MAX);
+        break;
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Saturating element-wise operation on int8 arrays (CLAMP_INT8 semantics).
+ *
+ * @param a    First input array.
+ * @param b    Second input array.
+ * @param dst  Output array (may be equal to `a` or `b`).
+ * @param size Number of elements in each array.
+ * @param op   Operation to apply.
+ *
+ * @retval ARRAY_STATUS_OK                     All results were in range.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more results were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    Unknown operation.
+ */
+static inline array_status_t array_binary_int8(const int8_t* a, const int8_t* b, int8_t* dst,
+                                               size_t size, binary_op_t op)
+{
+    array_status_t status = binary_op_check(a, b, dst, size, op);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t clamped = 0U;
+
+    switch (op)
+    {
+    case BINARY_OP_ADD:
+        clamped = binary_loop_int8(a, b, dst, size, BINARY_OP_ADD, INT8_MIN, INT8_MAX);
+        break;
+    case BINARY_OP_SUB:
+        clamped = binary_loop_int8(a, b, dst, size, BINARY_OP_SUB, INT8_MIN, INT8_MAX);
+        break;
+    case BINARY_OP_MUL:
+        clamped = binary_loop_int8(a, b, dst, size, BINARY_OP_MUL, INT8_MIN, INT8_MAX);
+        break;
+    case BINARY_OP_MIN:
+        clamped = binary_loop_int8(a, b, dst, size, BINARY_OP_MIN, INT8_MIN, INT8_MAX);
+        break;
+    case BINARY_OP_MAX:
+        clamped = binary_loop_int8(a, b, dst, size, BINARY_OP_MAX, INT8_MIN, INT8_MAX);
+        break;
+    default:
+        clamped = binary_loop_int8(a, b, dst, size, BINARY_OP_ABSDIFF, INT8_MIN, INT8_MAX);
+        break;
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Saturating element-wise operation on uint8 arrays (CLAMP_UINT8 semantics).
+ *
+ * @param a    First input array.
+ * @param b    Second input array.
+ * @param dst  Output array (may be equal to `a` or `b`).
+ * @param size Number of elements in each array.
+ * @param op   Operation to apply.
+ *
+ * @retval ARRAY_STATUS_OK                     All results were in range.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more results were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    Unknown operation.
+ */
+static inline array_status_t array_binary_uint8(const uint8_t* a, const uint8_t* b, uint8_t* dst,
+                                                size_t size, binary_op_t op)
+{
+    array_status_t status = binary_op_check(a, b, dst, size, op);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    uint32_t clamped = 0U;
+
+    switch (op)
+    {
+    case BINARY_OP_ADD:
+        clamped = binary_loop_uint8(a, b, dst, size, BINARY_OP_ADD, 0, UINT8_MAX);
+        break;
+    case BINARY_OP_SUB:
+        clamped = binary_loop_uint8(a, b, dst, size, BINARY_OP_SUB, 0, UINT8_MAX);
+        break;
+    case BINARY_OP_MUL:
+        clamped = binary_loop_uint8(a, b, dst, size, BINARY_OP_MUL, 0, UINT8_MAX);
+        break;
+    case BINARY_OP_MIN:
+        clamped = binary_loop_uint8(a, b, dst, size, BINARY_OP_MIN, 0, UINT8_MAX);
+        break;
+    case BINARY_OP_MAX:
+        clamped = binary_loop_uint8(a, b, dst, size, BINARY_OP_MAX, 0, UINT8_MAX);
+        break;
+    default:
+        clamped = binary_loop_uint8(a, b, dst, size, BINARY_OP_ABSDIFF, 0, UINT8_MAX);
+        break;
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+#endif // ARRAY_ELEMENTWISE_H
@@ -0,0 +1,261 @@
+/**
+ * @file array_fenwick.h
+ * @brief Fenwick (binary indexed) tree over int64 for prefix / range sums under point updates.
+ *
+ * Point updates and prefix sums both cost O(log n), instead of O(1) update + O(n) `array_sum()`.
+ * The tree is a single flat `int64_t` array of `size` entries provided by the caller (no
+ * pointers, no padding); entry `i` (1-based) holds the sum of the `i & -i` elements ending at
+ * `i`. Building from an int32 array is O(n): each entry is pushed once into its parent.
+ *
+ * Nodes are int64, so the sum of up to 2^32 int32 elements always fits; deltas passed to
+ * `array_fenwick_add()` are int64 and the caller keeps the totals within range.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_FENWICK_H
+#define ARRAY_FENWICK_H
+
+#include "array_status.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------
+//   Type Definitions
+// -----------------------------
+
+/**
+ * @brief Fenwick tree over caller-provided storage.
+ */
+typedef struct
+{
+    int64_t* tree; /**< size entries; tree[i - 1] is node i */
+    size_t size;   /**< Number of elements */
+} array_fenwick_t;
+
+// -----------------------------
+//   Helpers
+// -----------------------------
+
+/**
+ * @brief Lowest set bit of `i` (the length of the range covered by node `i`).
+ */
+static inline size_t fenwick_lowbit(size_t i)
+{
+    return i & (0U - i);
+}
+
+/**
+ * @brief Sum of the first `count` elements (count <= size, already validated).
+ */
+static inline int64_t fenwick_prefix(const array_fenwick_t* fw, size_t count)
+{
+    int64_t sum = 0;
+
+    for (size_t i = count; i > 0U; i -= fenwick_lowbit(i))
+    {
+        sum += fw->tree[i - 1U];
+    }
+
+    return sum;
+}
+
+// -----------------------------
+//   Build
+// -----------------------------
+
+/**
+ * @brief Builds a Fenwick tree from an int32 array in O(n).
+ *
+ * @param fw   Pointer to the tree handle.
+ * @param tree Storage for `size` int64 entries.
+ * @param src  Initial element values.
+ * @param size Number of elements.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_fenwick_build(array_fenwick_t* fw, int64_t* tree,
+                                                 const int32_t* src, size_t size)
+{
+    if (fw == NULL || tree == NULL || src == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        tree[i] = src[i];
+    }
+
+    // Each node adds its (complete) range sum into its parent, in increasing order
+    for (size_t i = 1U; i <= size; ++i)
+    {
+        size_t parent = i + fenwick_lowbit(i);
+        if (parent <= size)
+        {
+            tree[parent - 1U] += tree[i - 1U];
+        }
+    }
+
+    fw->tree = tree;
+    fw->size = size;
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Update
+// -----------------------------
+
+/**
+ * @brief Adds `delta` to element `index` in O(log n).
+ *
+ * @param fw    Pointer to a built tree.
+ * @param index Element index.
+ * @param delta Value to add.
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT Index out of range.
+ */
+static inline array_status_t array_fenwick_add(array_fenwick_t* fw, size_t index, int64_t delta)
+{
+    if (fw == NULL || fw->tree == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (index >= fw->size)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    for (size_t i = index + 1U; i <= fw->size; i += fenwick_lowbit(i))
+    {
+        fw->tree[i - 1U] += delta;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Queries
+// -----------------------------
+
+/**
+ * @brief Sum of elements [0, count) in O(log n).
+ *
+ * @param fw      Pointer to a built tree.
+ * @param count   Number of leading elements (0 gives 0).
+ * @param out_sum Pointer where the sum will be stored.
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT count > size.
+ */
+static inline array_status_t array_fenwick_prefix_sum(const array_fenwick_t* fw, size_t count,
+                                                      int64_t* out_sum)
+{
+    if (fw == NULL || fw->tree == NULL || out_sum == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (count > fw->size)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    *out_sum = fenwick_prefix(fw, count);
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Sum of elements [start, start + count) in O(log n).
+ *
+ * @param fw      Pointer to a built tree.
+ * @param start   First element.
+ * @param count   Number of elements.
+ * @param out_sum Pointer where the sum will be stored.
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         count was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT Range exceeds the array.
+ */
+static inline array_status_t array_fenwick_range_sum(const array_fenwick_t* fw, size_t start,
+                                                     size_t count, int64_t* out_sum)
+{
+    if (fw == NULL || fw->tree == NULL || out_sum == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (count == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if (start > fw->size || count > fw->size - start)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    *out_sum = fenwick_prefix(fw, start + count) - fenwick_prefix(fw, start);
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Finds the first index whose prefix sum (inclusive) reaches `target`, in O(log n).
+ *
+ * Descends the tree from the largest power of two down (binary lifting), so only one node per
+ * level is read. The prefix sums must be non-decreasing, i.e. all elements non-negative
+ * (counters, weights, histograms).
+ *
+ * @param fw        Pointer to a built tree with non-negative elements.
+ * @param target    Cumulative sum to reach.
+ * @param out_index Pointer set to the smallest `i` with sum of [0, i] >= target, or to `size`
+ *                  if the total is below `target`.
+ *
+ * @retval ARRAY_STATUS_OK         Success (check `*out_index`).
+ * @retval ARRAY_STATUS_ERROR_NULL NULL pointer was passed.
+ */
+static inline array_status_t array_fenwick_lower_bound(const array_fenwick_t* fw, int64_t target,
+                                                       size_t* out_index)
+{
+    if (fw == NULL || fw->tree == NULL || out_index == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    size_t step = 1U;
+    while (step <= fw->size / 2U)
+    {
+        step <<= 1;
+    }
+
+    // pos = number of leading elements whose sum is still below target
+    size_t pos = 0U;
+    int64_t remaining = target;
+
+    for (; step > 0U; step >>= 1)
+    {
+        size_t next = pos + step;
+        if (next <= fw->size && fw->tree[next - 1U] < remaining)
+        {
+            pos = next;
+            remaining -= fw->tree[next - 1U];
+        }
+    }
+
+    *out_index = pos;
+    return ARRAY_STATUS_OK;
+}
+
+#endif // ARRAY_FENWICK_H
@@ -0,0 +1,256 @@
+/**
+ * @file array_filter.h
+ * @brief Branch-free stream compaction: copy the elements (or indices) matching a predicate.
+ *
+ * The kernels never branch on the data. Every element is written to the next output slot and
+ * the output position advances by the 0/1 result of the predicate, so random data costs the
+ * same as sorted data. Because the output position never passes the input position, `dst`
+ * only needs room for `size` elements and may be the same pointer as `src` (in-place filter).
+ *
+ * Predicates are selected by `filter_pred_t`. The public functions dispatch once to a loop
+ * where the predicate is a constant, so each predicate gets its own specialized loop after
+ * inlining.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_FILTER_H
+#define ARRAY_FILTER_H
+
+#include "array_status.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------
+//   Type Definitions
+// -----------------------------
+
+/**
+ * @brief Element predicate, with operands `a` and `b` passed next to it.
+ */
+typedef enum
+{
+    FILTER_PRED_IN_RANGE, /**< a <= x <= b (same as IN_RANGE(x, a, b)) */
+    FILTER_PRED_GT,       /**< x > a */
+    FILTER_PRED_LT,       /**< x < a */
+    FILTER_PRED_EQ,       /**< x == a */
+    FILTER_PRED_NE        /**< x != a */
+} filter_pred_t;
+
+// -----------------------------
+//   Helpers
+// -----------------------------
+
+/**
+ * @brief Evaluates a predicate as 0 or 1 without branching.
+ *
+ * The range test uses one unsigned compare: `x - a` wraps above `b - a` for every `x`
+ * outside [a, b] (requires a <= b).
+ */
+static inline uint32_t filter_match(int32_t x, filter_pred_t pred, int32_t a, int32_t b)
+{
+    switch (pred)
+    {
+    case FILTER_PRED_IN_RANGE:
+        return (uint32_t) ((uint32_t) x - (uint32_t) a <= (uint32_t) b - (uint32_t) a);
+    case FILTER_PRED_GT:
+        return (uint32_t) (x > a);
+    case FILTER_PRED_LT:
+        return (uint32_t) (x < a);
+    case FILTER_PRED_EQ:
+        return (uint32_t) (x == a);
+    default:
+        return (uint32_t) (x != a);
+    }
+}
+
+/**
+ * @brief Validates the common arguments of all filter kernels.
+ */
+static inline array_status_t filter_check(const void* src, const void* dst, size_t size,
+                                          const size_t* out_count, filter_pred_t pred, int32_t a,
+                                          int32_t b)
+{
+    if (src == NULL || dst == NULL || out_count == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if ((unsigned) pred > (unsigned) FILTER_PRED_NE || (pred == FILTER_PRED_IN_RANGE && a > b))
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Compaction loop; `pred` is a constant at every call site.
+ */
+static inline size_t filter_values(const int32_t* src, size_t size, int32_t* dst,
+                                   filter_pred_t pred, int32_t a, int32_t b)
+{
+    size_t n = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        int32_t value = src[i];
+        dst[n] = value;
+        n += filter_match(value, pred, a, b);
+    }
+
+    return n;
+}
+
+/**
+ * @brief Index compaction loop; `pred` is a constant at every call site.
+ */
+static inline size_t filter_indices(const int32_t* src, size_t size, size_t* out_idx,
+                                    filter_pred_t pred, int32_t a, int32_t b)
+{
+    size_t n = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        out_idx[n] = i;
+        n += filter_match(src[i], pred, a, b);
+    }
+
+    return n;
+}
+
+// -----------------------------
+//   Compaction
+// -----------------------------
+
+/**
+ * @brief Copies the elements matching a predicate to the front of `dst`, keeping their order.
+ *
+ * `dst[0 .. *out_count - 1]` holds the survivors. Slots after them may be overwritten with
+ * rejected values.
+ *
+ * @param src       Input array.
+ * @param size      Number of elements.
+ * @param dst       Output array with room for `size` elements (may equal `src`).
+ * @param pred      Predicate.
+ * @param a         First operand (lower bound or threshold).
+ * @param b         Second operand (upper bound for FILTER_PRED_IN_RANGE, ignored otherwise).
+ * @param out_count Pointer where the number of survivors will be stored.
+ *
+ * @retval ARRAY_STATUS_OK                  Success (the survivor count may be 0).
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT Unknown predicate or a > b for a range.
+ */
+static inline array_status_t array_filter(const int32_t* src, size_t size, int32_t* dst,
+                                          filter_pred_t pred, int32_t a, int32_t b,
+                                          size_t* out_count)
+{
+    array_status_t status = filter_check(src, dst, size, out_count, pred, a, b);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    switch (pred)
+    {
+    case FILTER_PRED_IN_RANGE:
+        *out_count = filter_values(src, size, dst, FILTER_PRED_IN_RANGE, a, b);
+        break;
+    case FILTER_PRED_GT:
+        *out_count = filter_values(src, size, dst, FILTER_PRED_GT, a, b);
+        break;
+    case FILTER_PRED_LT:
+        *out_count = filter_values(src, size, dst, FILTER_PRED_LT, a, b);
+        break;
+    case FILTER_PRED_EQ:
+        *out_count = filter_values(src, size, dst, FILTER_PRED_EQ, a, b);
+        break;
+    default:
+        *out_count = filter_values(src, size, dst, FILTER_PRED_NE, a, b);
+        break;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Writes the indices of the elements matching a predicate, in increasing order.
+ *
+ * @param src       Input array.
+ * @param size      Number of elements.
+ * @param out_idx   Output index list with room for `size` entries.
+ * @param pred      Predicate.
+ * @param a         First operand (lower bound or threshold).
+ * @param b         Second operand (upper bound for FILTER_PRED_IN_RANGE, ignored otherwise).
+ * @param out_count Pointer where the number of matching indices will be stored.
+ *
+ * @retval ARRAY_STATUS_OK                  Success (the count may be 0).
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT Unknown predicate or a > b for a range.
+ */
+static inline array_status_t array_filter_indices(const int32_t* src, size_t size,
+                                                  size_t* out_idx, filter_pred_t pred, int32_t a,
+                                                  int32_t b, size_t* out_count)
+{
+    array_status_t status = filter_check(src, out_idx, size, out_count, pred, a, b);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    switch (pred)
+    {
+    case FILTER_PRED_IN_RANGE:
+        *out_count = filter_indices(src, size, out_idx, FILTER_PRED_IN_RANGE, a, b);
+        break;
+    case FILTER_PRED_GT:
+        *out_count = filter_indices(src, size, out_idx, FILTER_PRED_GT, a, b);
+        break;
+    case FILTER_PRED_LT:
+        *out_count = filter_indices(src, size, out_idx, FILTER_PRED_LT, a, b);
+        break;
+    case FILTER_PRED_EQ:
+        *out_count = filter_indices(src, size, out_idx, FILTER_PRED_EQ, a, b);
+        break;
+    default:
+        *out_count = filter_indices(src, size, out_idx, FILTER_PRED_NE, a, b);
+        break;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Shorthands
+// -----------------------------
+
+/**
+ * @brief Keeps the elements with lo <= x <= hi.
+ *
+ * @see array_filter()
+ */
+static inline array_status_t array_filter_in_range(const int32_t* src, size_t size, int32_t* dst,
+                                                   int32_t lo, int32_t hi, size_t* out_count)
+{
+    return array_filter(src, size, dst, FILTER_PRED_IN_RANGE, lo, hi, out_count);
+}
+
+/**
+ * @brief Keeps the elements with x > threshold.
+ *
+ * @see array_filter()
+ */
+static inline array_status_t array_filter_gt(const int32_t* src, size_t size, int32_t* dst,
+                                             int32_t threshold, size_t* out_count)
+{
+    return array_filter(src, size, dst, FILTER_PRED_GT, threshold, 0, out_count);
+}
+
+#endif // ARRAY_FILTER_H
@@ -0,0 +1,365 @@
+/**
+ * @file array_gather.h
+ * @brief Gather / scatter and index-list offset, scale and clamp for sparse updates.
+ *
+ * Indexed transforms have the same saturation semantics as `array_offset()`, `array_scale()` and
+ * `array_clamp()`, applied only to the listed elements (a repeated index is applied repeatedly).
+ * All indices are validated before anything is written, so an out-of-range index leaves the
+ * destination untouched.
+ *
+ * When the index list is strictly increasing, runs of consecutive indices of at least
+ * `GATHER_MIN_RUN` elements are handed to the dense kernels of `array_transform.h`.
+ * Other accesses use a scalar loop that prefetches `GATHER_PREFETCH_DISTANCE` indices ahead.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_GATHER_H
+#define ARRAY_GATHER_H
+
+#include "array_transform.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------
+//   Configuration
+// -----------------------------
+
+/** How many indices ahead the scalar loops prefetch. */
+#ifndef GATHER_PREFETCH_DISTANCE
+#define GATHER_PREFETCH_DISTANCE 16U
+#endif
+
+/** Minimum length of a run of consecutive indices that is sent to a dense kernel. */
+#ifndef GATHER_MIN_RUN
+#define GATHER_MIN_RUN 16U
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define GATHER_PREFETCH(addr, rw) __builtin_prefetch((addr), (rw))
+#else
+#define GATHER_PREFETCH(addr, rw) ((void) (addr))
+#endif
+
+// -----------------------------
+//   Helpers
+// -----------------------------
+
+/**
+ * @brief Operation applied by the indexed transforms.
+ */
+typedef enum
+{
+    INDEXED_OP_OFFSET,
+    INDEXED_OP_SCALE,
+    INDEXED_OP_CLAMP
+} indexed_op_t;
+
+/**
+ * @brief Checks that every index is below `limit` and, if `out_sorted` is not NULL, whether the
+ *        list is strictly increasing.
+ *
+ * @retval true  All indices are valid.
+ * @retval false At least one index is out of range.
+ */
+static inline bool gather_validate(const size_t* idx, size_t count, size_t limit,
+                                   bool* out_sorted)
+{
+    uint32_t invalid = 0U;
+    uint32_t unsorted = 0U;
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+        invalid |= (uint32_t) (idx[i] >= limit);
+    }
+
+    if (out_sorted != NULL)
+    {
+        for (size_t i = 1U; i < count; ++i)
+        {
+            unsorted |= (uint32_t) (idx[i] <= idx[i - 1U]);
+        }
+
+        *out_sorted = (unsorted == 0U);
+    }
+
+    return invalid == 0U;
+}
+
+/**
+ * @brief Applies one indexed op to a single value with `array_transform.h` semantics.
+ */
+static inline int32_t indexed_apply_one(int32_t value, indexed_op_t op, int32_t a, int32_t b,
+                                        int64_t lower, int64_t upper, uint32_t* clamped)
+{
+    if (op == INDEXED_OP_CLAMP)
+    {
+        value = (value < a) ? a : value;
+        return (value > b) ? b : value;
+    }
+
+    int64_t result = (op == INDEXED_OP_OFFSET) ? (int64_t) value + a : (int64_t) value * a;
+    *clamped |= (uint32_t) ((result < lower) | (result > upper));
+    result = (result < lower) ? lower : result;
+    result = (result > upper) ? upper : result;
+    return (int32_t) result;
+}
+
+/**
+ * @brief Runs the dense `array_transform.h` kernel for one op on a contiguous block.
+ *
+ * @return Non-zero if an offset or scale saturated.
+ */
+static inline uint32_t indexed_apply_dense(int32_t* block, size_t len, indexed_op_t op, int32_t a,
+                                           int32_t b, clamp_type_int_t type)
+{
+    switch (op)
+    {
+    case INDEXED_OP_OFFSET:
+        return (uint32_t) (array_offset(block, len, a, type) ==
+                           ARRAY_STATUS_WARNING_OVERFLOW_CLAMP);
+    case INDEXED_OP_SCALE:
+        return (uint32_t) (array_scale(block, len, a, type) == ARRAY_STATUS_WARNING_OVERFLOW_CLAMP);
+    default:
+        array_clamp(block, len, a, b);
+        return 0U;
+    }
+}
+
+/**
+ * @brief Common driver of the indexed transforms.
+ */
+static inline array_status_t indexed_apply(int32_t* array, size_t size, const size_t* idx,
+                                           size_t count, indexed_op_t op, int32_t a, int32_t b,
+                                           clamp_type_int_t type)
+{
+    if (array == NULL || idx == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U || count == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    bool sorted = false;
+    if (!gather_validate(idx, count, size, &sorted) || (op == INDEXED_OP_CLAMP && a > b))
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    if (op == INDEXED_OP_OFFSET && a == 0)
+    {
+        return ARRAY_STATUS_WARNING_OFFSET_IS_ZERO;
+    }
+
+    int32_t min = INT32_MIN;
+    int32_t max = INT32_MAX;
+    clamp_limits_int32(type, &min, &max);
+
+    // Same limits as array_offset() (direction of the offset only) and array_scale()
+    const int64_t lower = (op == INDEXED_OP_OFFSET && a > 0) ? INT64_MIN : min;
+    const int64_t upper = (op == INDEXED_OP_OFFSET && a < 0) ? INT64_MAX : max;
+    uint32_t clamped = 0U;
+    size_t i = 0U;
+
+    while (i < count)
+    {
+        // Length of the run of consecutive indices starting at i (only meaningful when sorted)
+        size_t run = 1U;
+        while (sorted && i + run < count && idx[i + run] == idx[i] + run)
+        {
+            run++;
+        }
+
+        if (run >= GATHER_MIN_RUN)
+        {
+            clamped |= indexed_apply_dense(&array[idx[i]], run, op, a, b, type);
+            i += run;
+            continue;
+        }
+
+        for (size_t end = i + run; i < end; ++i)
+        {
+            if (i + GATHER_PREFETCH_DISTANCE < count)
+            {
+                GATHER_PREFETCH(&array[idx[i + GATHER_PREFETCH_DISTANCE]], 1);
+            }
+
+            int32_t* slot = &array[idx[i]];
+            *slot = indexed_apply_one(*slot, op, a, b, lower, upper, &clamped);
+        }
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Gather / Scatter
+// -----------------------------
+
+/**
+ * @brief Gathers `dst[i] = src[idx[i]]`.
+ *
+ * @param src      Source array.
+ * @param src_size Number of elements in `src` (every index must be below it).
+ * @param idx      Index list.
+ * @param count    Number of indices (and of elements written to `dst`).
+ * @param dst      Output array.
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         src_size or count was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT An index was out of range (dst untouched).
+ */
+static inline array_status_t array_gather(const int32_t* src, size_t src_size, const size_t* idx,
+                                          size_t count, int32_t* dst)
+{
+    if (src == NULL || idx == NULL || dst == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (src_size == 0U || count == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if (!gather_validate(idx, count, src_size, NULL))
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+        if (i + GATHER_PREFETCH_DISTANCE < count)
+        {
+            GATHER_PREFETCH(&src[idx[i + GATHER_PREFETCH_DISTANCE]], 0);
+        }
+
+        dst[i] = src[idx[i]];
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Scatters `dst[idx[i]] = src[i]` (for repeated indices the last write wins).
+ *
+ * @param src      Source array of `count` elements.
+ * @param count    Number of indices.
+ * @param idx      Index list.
+ * @param dst      Output array.
+ * @param dst_size Number of elements in `dst` (every index must be below it).
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         count or dst_size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT An index was out of range (dst untouched).
+ */
+static inline array_status_t array_scatter(const int32_t* src, size_t count, const size_t* idx,
+                                           int32_t* dst, size_t dst_size)
+{
+    if (src == NULL || idx == NULL || dst == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (dst_size == 0U || count == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if (!gather_validate(idx, count, dst_size, NULL))
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+        if (i + GATHER_PREFETCH_DISTANCE < count)
+        {
+            GATHER_PREFETCH(&dst[idx[i + GATHER_PREFETCH_DISTANCE]], 1);
+        }
+
+        dst[idx[i]] = src[i];
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Indexed transforms
+// -----------------------------
+
+/**
+ * @brief `array_offset()` applied only to `array[idx[0..count)]`.
+ *
+ * @param array  Pointer to the array (modified in-place).
+ * @param size   Number of elements in the array.
+ * @param idx    Index list.
+ * @param count  Number of indices.
+ * @param offset The value to add to each listed element.
+ * @param type   Range to clamp against.
+ *
+ * @retval ARRAY_STATUS_OK                     All additions completed successfully.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_WARNING_OFFSET_IS_ZERO No operation performed, offset was 0.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            size or count was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    An index was out of range (array untouched).
+ */
+static inline array_status_t array_offset_indexed(int32_t* array, size_t size, const size_t* idx,
+                                                  size_t count, int32_t offset,
+                                                  clamp_type_int_t type)
+{
+    return indexed_apply(array, size, idx, count, INDEXED_OP_OFFSET, offset, 0, type);
+}
+
+/**
+ * @brief `array_scale()` applied only to `array[idx[0..count)]`.
+ *
+ * @param array  Pointer to the array (modified in-place).
+ * @param size   Number of elements in the array.
+ * @param idx    Index list.
+ * @param count  Number of indices.
+ * @param factor Multiplication factor.
+ * @param type   Range to clamp against.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements scaled successfully.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            size or count was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    An index was out of range (array untouched).
+ */
+static inline array_status_t array_scale_indexed(int32_t* array, size_t size, const size_t* idx,
+                                                 size_t count, int32_t factor,
+                                                 clamp_type_int_t type)
+{
+    return indexed_apply(array, size, idx, count, INDEXED_OP_SCALE, factor, 0, type);
+}
+
+/**
+ * @brief `array_clamp()` applied only to `array[idx[0..count)]`.
+ *
+ * @param array Pointer to the array (modified in-place).
+ * @param size  Number of elements in the array.
+ * @param idx   Index list.
+ * @param count Number of indices.
+ * @param min   Lower bound.
+ * @param max   Upper bound.
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         size or count was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT min > max, or an index was out of range.
+ */
+static inline array_status_t array_clamp_indexed(int32_t* array, size_t size, const size_t* idx,
+                                                 size_t count, int32_t min, int32_t max)
+{
+    return indexed_apply(array, size, idx, count, INDEXED_OP_CLAMP, min, max, CLAMP_INT32);
+}
+
+#endif // ARRAY_GATHER_H
@@ -0,0 +1,552 @@
+/**
+ * @file array_hash.h
+ * @brief CRC32C and a 64-bit multiply-mix hash of int32 arrays, with streaming and chunk
+ *        combination.
+ *
+ * - **CRC32C** (Castagnoli): on x86-64 with GCC / Clang the SSE4.2 `crc32` instruction is used
+ *   when the CPU supports it (checked once at run time), otherwise a table-driven software path
+ *   computes the same value. CRCs of consecutive chunks are joined with
+ *   `array_crc32c_combine()`.
+ * - **hash64**: every element is mixed with its position and the results are added, so chunks
+ *   can be hashed in any order (e.g. by several threads) and merged with
+ *   `array_hash64_combine()`. Faster than CRC32C in software and with 64 bits of output; not
+ *   meant to resist deliberately crafted collisions.
+ *
+ * Both hashes cover the element count, so `array_hash64()` of a buffer is a suitable cache key
+ * for memoizing `array_stats.h` results on that buffer. CRC32C is computed over the bytes in
+ * memory and therefore depends on the host byte order; hash64 works on values and does not.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_HASH_H
+#define ARRAY_HASH_H
+
+#include "array_status.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// -----------------------------
+//   Configuration
+// -----------------------------
+
+/** Reflected CRC32C (Castagnoli) polynomial. */
+#define HASH_CRC32C_POLY 0x82F63B78U
+
+/** Golden-ratio constant used to spread element positions. */
+#define HASH64_GOLDEN 0x9E3779B97F4A7C15U
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define HASH_CRC32C_HW 1
+#else
+#define HASH_CRC32C_HW 0
+#endif
+
+// -----------------------------
+//   Type Definitions
+// -----------------------------
+
+/**
+ * @brief Streaming CRC32C state.
+ */
+typedef struct
+{
+    uint32_t crc; /**< Running CRC (pre-inverted) */
+} array_crc32c_t;
+
+/**
+ * @brief Streaming / combinable hash64 state.
+ */
+typedef struct
+{
+    uint64_t acc;    /**< Sum of mixed elements */
+    uint64_t length; /**< Number of elements hashed (position of the next one) */
+} array_hash64_t;
+
+// -----------------------------
+//   CRC32C helpers
+// -----------------------------
+
+/** Byte-wise CRC32C lookup table (polynomial `HASH_CRC32C_POLY`). */
+static const uint32_t hash_crc32c_table[256] = {
+    0x00000000U, 0xF26B8303U, 0xE13B70F7U, 0x1350F3F4U, 0xC79A971FU, 0x35F1141CU,
+    0x26A1E7E8U, 0xD4CA64EBU, 0x8AD958CFU, 0x78B2DBCCU, 0x6BE22838U, 0x9989AB3BU,
+    0x4D43CFD0U, 0xBF284CD3U, 0xAC78BF27U, 0x5E133C24U, 0x105EC76FU, 0xE235446CU,
+    0xF165B798U, 0x030E349BU, 0xD7C45070U, 0x25AFD373U, 0x36FF2087U, 0xC494A384U,
+    0x9A879FA0U, 0x68EC1CA3U, 0x7BBCEF57U, 0x89D76C54U, 0x5D1D08BFU, 0xAF768BBCU,
+    0xBC267848U, 0x4E4DFB4BU, 0x20BD8EDEU, 0xD2D60DDDU, 0xC186FE29U, 0x33ED7D2AU,
+    0xE72719C1U, 0x154C9AC2U, 0x061C6936U, 0xF477EA35U, 0xAA64D611U, 0x580F5512U,
+    0x4B5FA6E6U, 0xB93425E5U, 0x6DFE410EU, 0x9F95C20DU, 0x8CC531F9U, 0x7EAEB2FAU,
+    0x30E349B1U, 0xC288CAB2U, 0xD1D83946U, 0x23B3BA45U, 0xF779DEAEU, 0x05125DADU,
+    0x1642AE59U, 0xE4292D5AU, 0xBA3A117EU, 0x4851927DU, 0x5B016189U, 0xA96AE28AU,
+    0x7DA08661U, 0x8FCB0562U, 0x9C9BF696U, 0x6EF07595U, 0x417B1DBCU, 0xB3109EBFU,
+    0xA0406D4BU, 0x522BEE48U, 0x86E18AA3U, 0x748A09A0U, 0x67DAFA54U, 0x95B17957U,
+    0xCBA24573U, 0x39C9C670U, 0x2A993584U, 0xD8F2B687U, 0x0C38D26CU, 0xFE53516FU,
+    0xED03A29BU, 0x1F682198U, 0x5125DAD3U, 0xA34E59D0U, 0xB01EAA24U, 0x42752927U,
+    0x96BF4DCCU, 0x64D4CECFU, 0x77843D3BU, 0x85EFBE38U, 0xDBFC821CU, 0x2997011FU,
+    0x3AC7F2EBU, 0xC8AC71E8U, 0x1C661503U, 0xEE0D9600U, 0xFD5D65F4U, 0x0F36E6F7U,
+    0x61C69362U, 0x93AD1061U, 0x80FDE395U, 0x72966096U, 0xA65C047DU, 0x5437877EU,
+    0x4767748AU, 0xB50CF789U, 0xEB1FCBADU, 0x197448AEU, 0x0A24BB5AU, 0xF84F3859U,
+    0x2C855CB2U, 0xDEEEDFB1U, 0xCDBE2C45U, 0x3FD5AF46U, 0x7198540DU, 0x83F3D70EU,
+    0x90A324FAU, 0x62C8A7F9U, 0xB602C312U, 0x44694011U, 0x5739B3E5U, 0xA55230E6U,
+    0xFB410CC2U, 0x092A8FC1U, 0x1A7A7C35U, 0xE811FF36U, 0x3CDB9BDDU, 0xCEB018DEU,
+    0xDDE0EB2AU, 0x2F8B6829U, 0x82F63B78U, 0x709DB87BU, 0x63CD4B8FU, 0x91A6C88CU,
+    0x456CAC67U, 0xB7072F64U, 0xA457DC90U, 0x563C5F93U, 0x082F63B7U, 0xFA44E0B4U,
+    0xE9141340U, 0x1B7F9043U, 0xCFB5F4A8U, 0x3DDE77ABU, 0x2E8E845FU, 0xDCE5075CU,
+    0x92A8FC17U, 0x60C37F14U, 0x73938CE0U, 0x81F80FE3U, 0x55326B08U, 0xA759E80BU,
+    0xB4091BFFU, 0x466298FCU, 0x1871A4D8U, 0xEA1A27DBU, 0xF94AD42FU, 0x0B21572CU,
+    0xDFEB33C7U, 0x2D80B0C4U, 0x3ED04330U, 0xCCBBC033U, 0xA24BB5A6U, 0x502036A5U,
+    0x4370C551U, 0xB11B4652U, 0x65D122B9U, 0x97BAA1BAU, 0x84EA524EU, 0x7681D14DU,
+    0x2892ED69U, 0xDAF96E6AU, 0xC9A99D9EU, 0x3BC21E9DU, 0xEF087A76U, 0x1D63F975U,
+    0x0E330A81U, 0xFC588982U, 0xB21572C9U, 0x407EF1CAU, 0x532E023EU, 0xA145813DU,
+    0x758FE5D6U, 0x87E466D5U, 0x94B49521U, 0x66DF1622U, 0x38CC2A06U, 0xCAA7A905U,
+    0xD9F75AF1U, 0x2B9CD9F2U, 0xFF56BD19U, 0x0D3D3E1AU, 0x1E6DCDEEU, 0xEC064EEDU,
+    0xC38D26C4U, 0x31E6A5C7U, 0x22B65633U, 0xD0DDD530U, 0x0417B1DBU, 0xF67C32D8U,
+    0xE52CC12CU, 0x1747422FU, 0x49547E0BU, 0xBB3FFD08U, 0xA86F0EFCU, 0x5A048DFFU,
+    0x8ECEE914U, 0x7CA56A17U, 0x6FF599E3U, 0x9D9E1AE0U, 0xD3D3E1ABU, 0x21B862A8U,
+    0x32E8915CU, 0xC083125FU, 0x144976B4U, 0xE622F5B7U, 0xF5720643U, 0x07198540U,
+    0x590AB964U, 0xAB613A67U, 0xB831C993U, 0x4A5A4A90U, 0x9E902E7BU, 0x6CFBAD78U,
+    0x7FAB5E8CU, 0x8DC0DD8FU, 0xE330A81AU, 0x115B2B19U, 0x020BD8EDU, 0xF0605BEEU,
+    0x24AA3F05U, 0xD6C1BC06U, 0xC5914FF2U, 0x37FACCF1U, 0x69E9F0D5U, 0x9B8273D6U,
+    0x88D28022U, 0x7AB90321U, 0xAE7367CAU, 0x5C18E4C9U, 0x4F48173DU, 0xBD23943EU,
+    0xF36E6F75U, 0x0105EC76U, 0x12551F82U, 0xE03E9C81U, 0x34F4F86AU, 0xC69F7B69U,
+    0xD5CF889DU, 0x27A40B9EU, 0x79B737BAU, 0x8BDCB4B9U, 0x988C474DU, 0x6AE7C44EU,
+    0xBE2DA0A5U, 0x4C4623A6U, 0x5F16D052U, 0xAD7D5351U
+};
+
+/**
+ * @brief Software CRC32C over `n` bytes.
+ */
+static inline uint32_t hash_crc32c_sw(uint32_t crc, const uint8_t* p, size_t n)
+{
+    for (size_t i = 0U; i < n; ++i)
+    {
+        crc = hash_crc32c_table[(crc ^ p[i]) & 0xFFU] ^ (crc >> 8);
+    }
+
+    return crc;
+}
+
+#if HASH_CRC32C_HW
+/**
+ * @brief CRC32C over `n` bytes with the SSE4.2 `crc32` instruction (8 bytes per step).
+ */
+__attribute__((target("sse4.2"))) static inline uint32_t hash_crc32c_hw(uint32_t crc,
+                                                                        const uint8_t* p, size_t n)
+{
+    uint64_t crc64 = crc;
+
+    while (n >= 8U)
+    {
+        uint64_t word;
+        memcpy(&word, p, sizeof(word));
+        crc64 = __builtin_ia32_crc32di(crc64, word);
+        p += 8;
+        n -= 8U;
+    }
+
+    crc = (uint32_t) crc64;
+    while (n-- > 0U)
+    {
+        crc = __builtin_ia32_crc32qi(crc, *p++);
+    }
+
+    return crc;
+}
+#endif
+
+/**
+ * @brief CRC32C over `n` bytes, using the hardware path when available.
+ */
+static inline uint32_t hash_crc32c_bytes(uint32_t crc, const uint8_t* p, size_t n)
+{
+#if HASH_CRC32C_HW
+    // Reads a flag filled in once by the runtime at startup, so no caching is needed here
+    if (__builtin_cpu_supports("sse4.2"))
+    {
+        return hash_crc32c_hw(crc, p, n);
+    }
+#endif
+
+    return hash_crc32c_sw(crc, p, n);
+}
+
+/**
+ * @brief Multiplies a 32x32 GF(2) matrix by a vector.
+ */
+static inline uint32_t hash_gf2_times(const uint32_t* mat, uint32_t vec)
+{
+    uint32_t sum = 0U;
+
+    for (size_t n = 0U; vec != 0U; ++n, vec >>= 1)
+    {
+        sum ^= (vec & 1U) ? mat[n] : 0U;
+    }
+
+    return sum;
+}
+
+/**
+ * @brief Squares a 32x32 GF(2) matrix.
+ */
+static inline void hash_gf2_square(uint32_t* square, const uint32_t* mat)
+{
+    for (size_t n = 0U; n < 32U; ++n)
+    {
+        square[n] = hash_gf2_times(mat, mat[n]);
+    }
+}
+
+// -----------------------------
+//   hash64 helpers
+// -----------------------------
+
+/**
+ * @brief 64-bit finalizer (xor-shift / multiply), every input bit affects every output bit.
+ */
+static inline uint64_t hash64_fmix(uint64_t k)
+{
+    k ^= k >> 33;
+    k *= 0xFF51AFD7ED558CCDU;
+    k ^= k >> 33;
+    k *= 0xC4CEB9FE1A85EC53U;
+    k ^= k >> 33;
+    return k;
+}
+
+/**
+ * @brief Adds the mixed elements `array[0 .. size - 1]`, located at `position`, to `acc`.
+ */
+static inline uint64_t hash64_accumulate(uint64_t acc, const int32_t* array, size_t size,
+                                         uint64_t position)
+{
+    for (size_t i = 0U; i < size; ++i)
+    {
+        uint64_t key = (uint64_t) (uint32_t) array[i] ^ ((position + i) * HASH64_GOLDEN);
+        acc += hash64_fmix(key);
+    }
+
+    return acc;
+}
+
+// -----------------------------
+//   CRC32C
+// -----------------------------
+
+/**
+ * @brief Starts a streaming CRC32C.
+ *
+ * @param state Pointer to the state.
+ *
+ * @retval ARRAY_STATUS_OK         Success.
+ * @retval ARRAY_STATUS_ERROR_NULL NULL pointer was passed.
+ */
+static inline array_status_t array_crc32c_init(array_crc32c_t* state)
+{
+    if (state == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    state->crc = 0xFFFFFFFFU;
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Feeds the next chunk of elements into a streaming CRC32C.
+ *
+ * @param state Pointer to an initialized state.
+ * @param array Chunk of elements.
+ * @param size  Number of elements in the chunk.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Chunk size was 0.
+ */
+static inline array_status_t array_crc32c_update(array_crc32c_t* state, const int32_t* array,
+                                                 size_t size)
+{
+    if (state == NULL || array == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    state->crc = hash_crc32c_bytes(state->crc, (const uint8_t*) array, size * sizeof(int32_t));
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Returns the CRC32C of everything fed so far (the state stays usable).
+ *
+ * @param state   Pointer to an initialized state.
+ * @param out_crc Pointer where the CRC will be stored.
+ *
+ * @retval ARRAY_STATUS_OK         Success.
+ * @retval ARRAY_STATUS_ERROR_NULL NULL pointer was passed.
+ */
+static inline array_status_t array_crc32c_final(const array_crc32c_t* state, uint32_t* out_crc)
+{
+    if (state == NULL || out_crc == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    *out_crc = ~state->crc;
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief One-shot CRC32C of an array.
+ *
+ * @param array   Input array.
+ * @param size    Number of elements.
+ * @param out_crc Pointer where the CRC will be stored.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_crc32c(const int32_t* array, size_t size, uint32_t* out_crc)
+{
+    array_crc32c_t state;
+
+    if (out_crc == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    array_crc32c_init(&state);
+    array_status_t status = array_crc32c_update(&state, array, size);
+    if (status == ARRAY_STATUS_OK)
+    {
+        array_crc32c_final(&state, out_crc);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Computes CRC32C(A followed by B) from CRC32C(A), CRC32C(B) and the length of B.
+ *
+ * Lets chunks be checksummed independently (e.g. in parallel) and joined in order afterwards.
+ * Costs O(log size2) GF(2) matrix squarings, independent of the chunk contents.
+ *
+ * @param crc1  CRC32C of the first chunk.
+ * @param crc2  CRC32C of the second chunk.
+ * @param size2 Number of elements in the second chunk.
+ *
+ * @return CRC32C of the concatenation.
+ */
+static inline uint32_t array_crc32c_combine(uint32_t crc1, uint32_t crc2, size_t size2)
+{
+    uint32_t even[32];
+    uint32_t odd[32];
+    uint64_t bytes = (uint64_t) size2 * sizeof(int32_t);
+
+    if (bytes == 0U)
+    {
+        return crc1;
+    }
+
+    // Operator for one zero bit
+    odd[0] = HASH_CRC32C_POLY;
+    for (size_t n = 1U; n < 32U; ++n)
+    {
+        odd[n] = (uint32_t) 1U << (n - 1U);
+    }
+
+    hash_gf2_square(even, odd); // two zero bits
+    hash_gf2_square(odd, even); // four zero bits
+
+    // Apply one zero byte, two, four, ... for each set bit of the byte count
+    do
+    {
+        hash_gf2_square(even, odd);
+        if (bytes & 1U)
+        {
+            crc1 = hash_gf2_times(even, crc1);
+        }
+        bytes >>= 1;
+
+        if (bytes == 0U)
+        {
+            break;
+        }
+
+        hash_gf2_square(odd, even);
+        if (bytes & 1U)
+        {
+            crc1 = hash_gf2_times(odd, crc1);
+        }
+        bytes >>= 1;
+    } while (bytes != 0U);
+
+    return crc1 ^ crc2;
+}
+
+// -----------------------------
+//   hash64
+// -----------------------------
+
+/**
+ * @brief Starts a streaming hash64.
+ *
+ * @param state Pointer to the state.
+ *
+ * @retval ARRAY_STATUS_OK         Success.
+ * @retval ARRAY_STATUS_ERROR_NULL NULL pointer was passed.
+ */
+static inline array_status_t array_hash64_init(array_hash64_t* state)
+{
+    if (state == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    state->acc = 0U;
+    state->length = 0U;
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Feeds the next chunk of elements into a streaming hash64.
+ *
+ * @param state Pointer to an initialized state.
+ * @param array Chunk of elements (continues right after the previous one).
+ * @param size  Number of elements in the chunk.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Chunk size was 0.
+ */
+static inline array_status_t array_hash64_update(array_hash64_t* state, const int32_t* array,
+                                                 size_t size)
+{
+    if (state == NULL || array == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    state->acc = hash64_accumulate(state->acc, array, size, state->length);
+    state->length += size;
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Hashes one chunk located at `offset` in the full array, independently of the others.
+ *
+ * Each worker hashes its own chunk into its own state; the states are then merged with
+ * `array_hash64_combine()` in any order.
+ *
+ * @param array     Chunk of elements.
+ * @param size      Number of elements in the chunk.
+ * @param offset    Index of the chunk's first element in the full array.
+ * @param out_state Pointer where the chunk state will be stored.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Chunk size was 0.
+ */
+static inline array_status_t array_hash64_chunk(const int32_t* array, size_t size, size_t offset,
+                                                array_hash64_t* out_state)
+{
+    if (array == NULL || out_state == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    out_state->acc = hash64_accumulate(0U, array, size, offset);
+    out_state->length = size;
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Merges the state of another chunk into `state`.
+ *
+ * @param state Pointer to the accumulated state.
+ * @param other Pointer to the state of a chunk not yet included.
+ *
+ * @retval ARRAY_STATUS_OK         Success.
+ * @retval ARRAY_STATUS_ERROR_NULL NULL pointer was passed.
+ */
+static inline array_status_t array_hash64_combine(array_hash64_t* state,
+                                                  const array_hash64_t* other)
+{
+    if (state == NULL || other == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    state->acc += other->acc;
+    state->length += other->length;
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Returns the hash of everything fed so far (the state stays usable).
+ *
+ * @param state    Pointer to a state.
+ * @param out_hash Pointer where the hash will be stored.
+ *
+ * @retval ARRAY_STATUS_OK         Success.
+ * @retval ARRAY_STATUS_ERROR_NULL NULL pointer was passed.
+ */
+static inline array_status_t array_hash64_final(const array_hash64_t* state, uint64_t* out_hash)
+{
+    if (state == NULL || out_hash == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    *out_hash = hash64_fmix(state->acc ^ hash64_fmix(state->length + HASH64_GOLDEN));
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief One-shot hash64 of an array (e.g. as a cache key for its statistics).
+ *
+ * @param array    Input array.
+ * @param size     Number of elements.
+ * @param out_hash Pointer where the hash will be stored.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_hash64(const int32_t* array, size_t size, uint64_t* out_hash)
+{
+    array_hash64_t state;
+
+    if (out_hash == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    array_hash64_init(&state);
+    array_status_t status = array_hash64_update(&state, array, size);
+    if (status == ARRAY_STATUS_OK)
+    {
+        array_hash64_final(&state, out_hash);
+    }
+
+    return status;
+}
+
+#endif // ARRAY_HASH_H
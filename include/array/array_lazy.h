@@ -0,0 +1,397 @@
+/**
+ * @file array_lazy.h
+ * @brief Array handle with O(1) deferred offset / scale and tracked min, max and sum.
+ *
+ * Successive `array_lazy_offset()` / `array_lazy_scale()` calls are folded into one pending
+ * affine transform `value * mul + add`. The handle keeps the exact min, max and sum of the stored
+ * data, so it can prove in O(1) that an operation cannot saturate and that the stats of the
+ * transformed array follow directly from the pending transform.
+ *
+ * Memory is written only when the data is read (`array_lazy_materialize()`) or when the next
+ * operation would saturate. In that case the pending transform and the saturating operation are
+ * applied in a single fused pass, with exactly the results of calling `array_offset()` /
+ * `array_scale()` one after the other.
+ *
+ * @warning Do not modify `data` directly while a handle is in use (re-init the handle instead).
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_LAZY_H
+#define ARRAY_LAZY_H
+
+#include "array_transform.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------
+//   Type Definitions
+// -----------------------------
+
+/**
+ * @brief Lazily transformed int32 array.
+ */
+typedef struct
+{
+    int32_t* data;         /**< Stored elements (pending transform not yet applied) */
+    size_t size;           /**< Number of elements */
+    clamp_type_int_t type; /**< Range that operations saturate against */
+    int64_t mul;           /**< Pending multiplier (|mul| <= INT32_MAX) */
+    int64_t add;           /**< Pending addend */
+    array_range_t range;   /**< Exact min / max of the stored elements */
+    int64_t sum;           /**< Exact sum of the stored elements */
+} array_lazy_t;
+
+// -----------------------------
+//   Helpers
+// -----------------------------
+
+/**
+ * @brief Pending transform applied to one stored value (never overflows, see `lazy_compose()`).
+ */
+static inline int64_t lazy_eval(const array_lazy_t* lazy, int64_t value)
+{
+    return value * lazy->mul + lazy->add;
+}
+
+/**
+ * @brief Envelope [low, high] of the transformed array.
+ */
+static inline void lazy_envelope(const array_lazy_t* lazy, int64_t* low, int64_t* high)
+{
+    int64_t a = lazy_eval(lazy, lazy->range.min);
+    int64_t b = lazy_eval(lazy, lazy->range.max);
+    *low = (a < b) ? a : b;
+    *high = (a < b) ? b : a;
+}
+
+/**
+ * @brief Applies the pending transform and then one saturating operation in a single pass.
+ *
+ * Rebuilds min / max / sum of the stored data in the same pass and resets the pending transform.
+ *
+ * @param op      OPERATION_OFFSET or OPERATION_SCALE.
+ * @param operand Offset or factor; an offset of 0 applies only the pending transform.
+ *
+ * @return Number of elements clamped by the operation.
+ */
+static inline size_t lazy_flush(array_lazy_t* lazy, operation_check_type_t op, int32_t operand)
+{
+    int32_t min = INT32_MIN;
+    int32_t max = INT32_MAX;
+    clamp_limits_int32(lazy->type, &min, &max);
+
+    // Same limits as array_offset() / array_scale()
+    int64_t upper = max;
+    int64_t lower = min;
+    if (op == OPERATION_OFFSET)
+    {
+        upper = (operand > 0) ? max : INT64_MAX;
+        lower = (operand < 0) ? min : INT64_MIN;
+    }
+
+    int32_t new_min = INT32_MAX;
+    int32_t new_max = INT32_MIN;
+    int64_t sum = 0;
+    size_t count = 0U;
+
+    for (size_t i = 0U; i < lazy->size; ++i)
+    {
+        int64_t value = lazy_eval(lazy, lazy->data[i]);
+        value = (op == OPERATION_OFFSET) ? value + operand : value * operand;
+
+        count += (size_t) ((value > upper) | (value < lower));
+        value = (value > upper) ? upper : value;
+        value = (value < lower) ? lower : value;
+
+        int32_t result = (int32_t) value;
+        lazy->data[i] = result;
+        new_min = (result < new_min) ? result : new_min;
+        new_max = (result > new_max) ? result : new_max;
+        sum += result;
+    }
+
+    lazy->mul = 1;
+    lazy->add = 0;
+    lazy->range.min = new_min;
+    lazy->range.max = new_max;
+    lazy->sum = sum;
+    return count;
+}
+
+/**
+ * @brief Folds `value * mul + add` into the pending transform if that is provably exact.
+ *
+ * @retval true  The pending transform was updated; memory is untouched.
+ * @retval false The operation may saturate (or the multiplier would grow too large).
+ */
+static inline bool lazy_compose(array_lazy_t* lazy, operation_check_type_t op, int32_t operand)
+{
+    int32_t min = INT32_MIN;
+    int32_t max = INT32_MAX;
+    clamp_limits_int32(lazy->type, &min, &max);
+
+    int64_t low = 0;
+    int64_t high = 0;
+    lazy_envelope(lazy, &low, &high);
+
+    if (op == OPERATION_OFFSET)
+    {
+        // Only the limit in the direction of the offset can be crossed
+        if ((operand > 0 && high + operand > max) || (operand < 0 && low + operand < min))
+        {
+            return false;
+        }
+
+        lazy->add += operand;
+        return true;
+    }
+
+    // The transformed values are within int32, so these products fit in int64
+    int64_t a = low * operand;
+    int64_t b = high * operand;
+    int64_t mul = lazy->mul * operand;
+
+    // Keeping |mul| <= INT32_MAX bounds every intermediate of lazy_eval() below 2^63
+    if (a < min || a > max || b < min || b > max || mul > INT32_MAX || mul < -(int64_t) INT32_MAX)
+    {
+        return false;
+    }
+
+    lazy->mul = mul;
+    lazy->add *= operand;
+    return true;
+}
+
+// -----------------------------
+//   Setup
+// -----------------------------
+
+/**
+ * @brief Wraps an array in a lazy handle, computing its min, max and sum in one pass.
+ *
+ * @param lazy Pointer to the handle.
+ * @param data Pointer to the array (owned by the caller, modified on materialization).
+ * @param size Number of elements.
+ * @param type Range that offsets and scales saturate against.
+ *
+ * @retval ARRAY_STATUS_OK          Handle ready, no pending transform.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_lazy_init(array_lazy_t* lazy, int32_t* data, size_t size,
+                                             clamp_type_int_t type)
+{
+    if (lazy == NULL || data == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    lazy->data = data;
+    lazy->size = size;
+    lazy->type = type;
+    lazy->mul = 1;
+    lazy->add = 0;
+    lazy->range.min = data[0];
+    lazy->range.max = data[0];
+    lazy->sum = 0;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        lazy->range.min = (data[i] < lazy->range.min) ? data[i] : lazy->range.min;
+        lazy->range.max = (data[i] > lazy->range.max) ? data[i] : lazy->range.max;
+        lazy->sum += data[i];
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Returns whether the handle has a transform that is not yet written to memory.
+ */
+static inline bool array_lazy_pending(const array_lazy_t* lazy)
+{
+    return lazy != NULL && (lazy->mul != 1 || lazy->add != 0);
+}
+
+// -----------------------------
+//   Deferred operations
+// -----------------------------
+
+/**
+ * @brief Lazy equivalent of `array_offset()`.
+ *
+ * O(1) unless the offset could saturate, in which case the pending transform and the offset are
+ * applied in one fused pass.
+ *
+ * @param lazy   Pointer to an initialized handle.
+ * @param offset The value to add to each element.
+ *
+ * @retval ARRAY_STATUS_OK                     Offset recorded (or applied without clamping).
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_WARNING_OFFSET_IS_ZERO No operation performed, offset was 0.
+ * @retval ARRAY_STATUS_ERROR_NULL             Handle pointer was NULL.
+ */
+static inline array_status_t array_lazy_offset(array_lazy_t* lazy, int32_t offset)
+{
+    if (lazy == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (offset == 0)
+    {
+        return ARRAY_STATUS_WARNING_OFFSET_IS_ZERO;
+    }
+
+    if (lazy_compose(lazy, OPERATION_OFFSET, offset))
+    {
+        return ARRAY_STATUS_OK;
+    }
+
+    size_t count = lazy_flush(lazy, OPERATION_OFFSET, offset);
+    return (count != 0U) ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Lazy equivalent of `array_scale()`.
+ *
+ * @param lazy   Pointer to an initialized handle.
+ * @param factor Multiplication factor.
+ *
+ * @retval ARRAY_STATUS_OK                     Scale recorded (or applied without clamping).
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             Handle pointer was NULL.
+ */
+static inline array_status_t array_lazy_scale(array_lazy_t* lazy, int32_t factor)
+{
+    if (lazy == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (lazy_compose(lazy, OPERATION_SCALE, factor))
+    {
+        return ARRAY_STATUS_OK;
+    }
+
+    size_t count = lazy_flush(lazy, OPERATION_SCALE, factor);
+    return (count != 0U) ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Writes the pending transform to memory so `lazy->data` can be read directly.
+ *
+ * @param lazy Pointer to an initialized handle.
+ *
+ * @retval ARRAY_STATUS_OK         Data is up to date (no pass if nothing was pending).
+ * @retval ARRAY_STATUS_ERROR_NULL Handle pointer was NULL.
+ */
+static inline array_status_t array_lazy_materialize(array_lazy_t* lazy)
+{
+    if (lazy == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (array_lazy_pending(lazy))
+    {
+        lazy_flush(lazy, OPERATION_OFFSET, 0);
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Statistics (no memory access)
+// -----------------------------
+
+/**
+ * @brief Minimum of the transformed array, computed from the tracked range in O(1).
+ *
+ * @param lazy    Pointer to an initialized handle.
+ * @param out_min Pointer where the minimum will be stored.
+ *
+ * @retval ARRAY_STATUS_OK         Success.
+ * @retval ARRAY_STATUS_ERROR_NULL NULL pointer was passed.
+ */
+static inline array_status_t array_lazy_min(const array_lazy_t* lazy, int32_t* out_min)
+{
+    if (lazy == NULL || out_min == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    int64_t low = 0;
+    int64_t high = 0;
+    lazy_envelope(lazy, &low, &high);
+    *out_min = (int32_t) low;
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Maximum of the transformed array, computed from the tracked range in O(1).
+ *
+ * @param lazy    Pointer to an initialized handle.
+ * @param out_max Pointer where the maximum will be stored.
+ *
+ * @retval ARRAY_STATUS_OK         Success.
+ * @retval ARRAY_STATUS_ERROR_NULL NULL pointer was passed.
+ */
+static inline array_status_t array_lazy_max(const array_lazy_t* lazy, int32_t* out_max)
+{
+    if (lazy == NULL || out_max == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    int64_t low = 0;
+    int64_t high = 0;
+    lazy_envelope(lazy, &low, &high);
+    *out_max = (int32_t) high;
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Sum of the transformed array, `mul * sum + add * size`, in O(1).
+ *
+ * The overflow check uses the pending multiplier, so an offset-only transform (`mul == 1`) is
+ * answered without touching memory for any realistic sum. Only if the expression could overflow
+ * int64 in an intermediate step is the pending transform materialized first.
+ *
+ * @param lazy    Pointer to an initialized handle.
+ * @param out_sum Pointer where the sum will be stored.
+ *
+ * @retval ARRAY_STATUS_OK         Success.
+ * @retval ARRAY_STATUS_ERROR_NULL NULL pointer was passed.
+ */
+static inline array_status_t array_lazy_sum(array_lazy_t* lazy, int64_t* out_sum)
+{
+    if (lazy == NULL || out_sum == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    // Both products below 2^62 keep the expression exact; bounded by the actual pending |mul|
+    const uint64_t abs_sum = (lazy->sum < 0) ? 0U - (uint64_t) lazy->sum : (uint64_t) lazy->sum;
+    const uint64_t abs_mul = (lazy->mul < 0) ? 0U - (uint64_t) lazy->mul : (uint64_t) lazy->mul;
+    const uint64_t abs_add = (lazy->add < 0) ? 0U - (uint64_t) lazy->add : (uint64_t) lazy->add;
+    const bool fits = (abs_mul == 0U || abs_sum <= (uint64_t) INT64_MAX / 2U / abs_mul) &&
+                      (abs_add <= (uint64_t) INT64_MAX / 2U / lazy->size);
+
+    if (!fits)
+    {
+        array_lazy_materialize(lazy);
+    }
+
+    *out_sum = lazy->sum * lazy->mul + lazy->add * (int64_t) lazy->size;
+    return ARRAY_STATUS_OK;
+}
+
+#endif // ARRAY_LAZY_H
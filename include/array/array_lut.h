@@ -0,0 +1,300 @@
+/**
+ * @file array_lut.h
+ * @brief 256-entry lookup-table transforms for 8-bit arrays (uint8 / int8).
+ *
+ * For 8-bit data saturated to its own range (CLAMP_UINT8 / CLAMP_INT8), any chain of offset,
+ * scale and clamp operations is a function from 256 values to 256 values. The chain is compiled
+ * once into a table, and applying it costs one table lookup per byte, whatever its length.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_LUT_H
+#define ARRAY_LUT_H
+
+#include "array_transform.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------
+//   Type Definitions
+// -----------------------------
+
+/**
+ * @brief Operation of a LUT transform chain.
+ */
+typedef enum
+{
+    LUT_OP_OFFSET,      /**< value + a */
+    LUT_OP_SCALE,       /**< value * a */
+    LUT_OP_SCALE_FIXED, /**< round(value * a / 2^b), see `array_scale_fixed()` */
+    LUT_OP_CLAMP        /**< clamp(value, a, b) */
+} lut_op_type_t;
+
+/**
+ * @brief One step of a LUT transform chain.
+ */
+typedef struct
+{
+    lut_op_type_t op; /**< Operation to apply */
+    int32_t a;        /**< Offset, factor or lower bound */
+    int32_t b;        /**< Fractional bits (SCALE_FIXED) or upper bound (CLAMP) */
+} lut_op_t;
+
+/**
+ * @brief Compiled 256-entry transform table.
+ *
+ * The table is indexed by the raw byte of the input element (`(uint8_t) value` for int8 data).
+ */
+typedef struct
+{
+    uint8_t table[256];    /**< Output byte for every input byte */
+    uint64_t saturated[4]; /**< Bit set for every input byte whose chain saturated */
+} array_lut_t;
+
+// -----------------------------
+//   Build
+// -----------------------------
+
+/**
+ * @brief Evaluates a transform chain on one value, saturating to [lo, hi] after each step.
+ *
+ * @retval ARRAY_STATUS_OK                     Value transformed without saturation.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP At least one step saturated or clamped the value.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    Unknown operation or invalid parameters.
+ */
+static inline array_status_t lut_eval_chain(int32_t value, const lut_op_t* ops, size_t op_count,
+                                            int32_t lo, int32_t hi, int32_t* out_value)
+{
+    bool clamped = false;
+
+    for (size_t k = 0U; k < op_count; ++k)
+    {
+        int64_t result = value;
+        int64_t step_lo = lo;
+        int64_t step_hi = hi;
+
+        switch (ops[k].op)
+        {
+        case LUT_OP_OFFSET:
+            result = (int64_t) value + ops[k].a;
+            break;
+        case LUT_OP_SCALE:
+            result = (int64_t) value * ops[k].a;
+            break;
+        case LUT_OP_SCALE_FIXED:
+            if (ops[k].b < 1 || ops[k].b > 31)
+            {
+                return ARRAY_STATUS_ERROR_INVALID_INPUT;
+            }
+            result = ((int64_t) value * ops[k].a +
+                      fixed_round_bias((unsigned) ops[k].b, ROUNDING_NEAREST)) >>
+                     ops[k].b;
+            break;
+        case LUT_OP_CLAMP:
+            if (ops[k].a > ops[k].b)
+            {
+                return ARRAY_STATUS_ERROR_INVALID_INPUT;
+            }
+            step_lo = (ops[k].a > lo) ? ops[k].a : lo;
+            step_hi = (ops[k].b < hi) ? ops[k].b : hi;
+
+            // Bounds entirely outside the table range: saturate to the nearer type limit
+            if (step_lo > step_hi)
+            {
+                step_lo = (ops[k].a > hi) ? hi : lo;
+                step_hi = step_lo;
+                clamped = true;
+            }
+            break;
+        default:
+            return ARRAY_STATUS_ERROR_INVALID_INPUT;
+        }
+
+        if (result < step_lo || result > step_hi)
+        {
+            clamped = true;
+            result = (result < step_lo) ? step_lo : step_hi;
+        }
+
+        value = (int32_t) result;
+    }
+
+    *out_value = value;
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Compiles a transform chain for uint8 data (saturating to CLAMP_UINT8 after each step).
+ *
+ * @param lut      Pointer to the table to build.
+ * @param ops      Transform chain, applied in order (may be NULL if op_count is 0).
+ * @param op_count Number of operations in the chain.
+ *
+ * @retval ARRAY_STATUS_OK                  Table built.
+ * @retval ARRAY_STATUS_ERROR_NULL          lut is NULL, or ops is NULL with op_count > 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT Unknown operation or invalid parameters.
+ */
+static inline array_status_t array_lut_build_uint8(array_lut_t* lut, const lut_op_t* ops,
+                                                   size_t op_count)
+{
+    if (lut == NULL || (ops == NULL && op_count > 0U))
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    for (size_t w = 0U; w < 4U; ++w)
+    {
+        lut->saturated[w] = 0U;
+    }
+
+    for (int32_t i = 0; i < 256; ++i)
+    {
+        int32_t value = 0;
+        array_status_t status = lut_eval_chain(i, ops, op_count, 0, UINT8_MAX, &value);
+        if (status == ARRAY_STATUS_ERROR_INVALID_INPUT)
+        {
+            return status;
+        }
+
+        lut->table[i] = (uint8_t) value;
+        lut->saturated[i / 64] |= (uint64_t) (status == ARRAY_STATUS_WARNING_OVERFLOW_CLAMP)
+                                  << (i % 64);
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Compiles a transform chain for int8 data (saturating to CLAMP_INT8 after each step).
+ *
+ * @param lut      Pointer to the table to build.
+ * @param ops      Transform chain, applied in order (may be NULL if op_count is 0).
+ * @param op_count Number of operations in the chain.
+ *
+ * @retval ARRAY_STATUS_OK                  Table built.
+ * @retval ARRAY_STATUS_ERROR_NULL          lut is NULL, or ops is NULL with op_count > 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT Unknown operation or invalid parameters.
+ */
+static inline array_status_t array_lut_build_int8(array_lut_t* lut, const lut_op_t* ops,
+                                                  size_t op_count)
+{
+    if (lut == NULL || (ops == NULL && op_count > 0U))
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    for (size_t w = 0U; w < 4U; ++w)
+    {
+        lut->saturated[w] = 0U;
+    }
+
+    for (int32_t v = INT8_MIN; v <= INT8_MAX; ++v)
+    {
+        int32_t value = 0;
+        array_status_t status = lut_eval_chain(v, ops, op_count, INT8_MIN, INT8_MAX, &value);
+        if (status == ARRAY_STATUS_ERROR_INVALID_INPUT)
+        {
+            return status;
+        }
+
+        uint8_t index = (uint8_t) (v & 0xFF);
+        lut->table[index] = (uint8_t) (value & 0xFF);
+        lut->saturated[index / 64U] |=
+            (uint64_t) (status == ARRAY_STATUS_WARNING_OVERFLOW_CLAMP) << (index % 64U);
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Apply
+// -----------------------------
+
+/**
+ * @brief Applies a compiled table to a byte array (out-of-place or in-place).
+ *
+ * Saturation is reported per element from the table's `saturated` bits, in the same pass as the
+ * lookup. The optional mask uses the layout of `array_clamp_report()`.
+ *
+ * @param lut       Compiled table.
+ * @param src       Input bytes.
+ * @param dst       Output bytes (may be equal to `src`).
+ * @param size      Number of elements.
+ * @param out_count Optional pointer where the number of saturated elements is stored.
+ * @param out_mask  Optional bitmask of `CLAMP_MASK_WORDS(size)` words.
+ *
+ * @retval ARRAY_STATUS_OK                     No element saturated.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more elements saturated.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_lut_apply(const array_lut_t* lut, const uint8_t* src,
+                                             uint8_t* dst, size_t size, size_t* out_count,
+                                             uint64_t* out_mask)
+{
+    if (lut == NULL || src == NULL || dst == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    size_t count = 0U;
+
+    for (size_t base = 0U; base < size; base += CLAMP_MASK_WORD_BITS)
+    {
+        size_t end = (size - base < CLAMP_MASK_WORD_BITS) ? size : base + CLAMP_MASK_WORD_BITS;
+        uint64_t word = 0U;
+
+        for (size_t i = base; i < end; ++i)
+        {
+            uint8_t in = src[i];
+            uint64_t flag = (lut->saturated[in >> 6] >> (in & 63U)) & 1U;
+
+            dst[i] = lut->table[in];
+            word |= flag << (i - base);
+            count += (size_t) flag;
+        }
+
+        if (out_mask != NULL)
+        {
+            out_mask[base / CLAMP_MASK_WORD_BITS] = word;
+        }
+    }
+
+    if (out_count != NULL)
+    {
+        *out_count = count;
+    }
+
+    return (count != 0U) ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Applies a table built with `array_lut_build_int8()` to an int8 array.
+ *
+ * @param lut       Compiled table.
+ * @param src       Input array.
+ * @param dst       Output array (may be equal to `src`).
+ * @param size      Number of elements.
+ * @param out_count Optional pointer where the number of saturated elements is stored.
+ * @param out_mask  Optional bitmask of `CLAMP_MASK_WORDS(size)` words.
+ *
+ * @retval ARRAY_STATUS_OK                     No element saturated.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more elements saturated.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_lut_apply_int8(const array_lut_t* lut, const int8_t* src,
+                                                  int8_t* dst, size_t size, size_t* out_count,
+                                                  uint64_t* out_mask)
+{
+    return array_lut_apply(lut, (const uint8_t*) src, (uint8_t*) dst, size, out_count, out_mask);
+}
+
+#endif // ARRAY_LUT_H
@@ -0,0 +1,323 @@
+/**
+ * @file array_noise.h
+ * @brief Noise reduction for integer arrays (streaming FIR low-pass filter).
+ *
+ * The filter computes `y[n] = sum(taps[k] * x[n - k])` with fixed-point coefficients, rounds to
+ * nearest and saturates to the selected clamp range. The last `tap_count - 1` input samples are
+ * kept in the filter state, so a long signal can be processed chunk by chunk with exactly the
+ * same output as a single call, without re-reading any overlap.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_NOISE_H
+#define ARRAY_NOISE_H
+
+#include "array_transform.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// -----------------------------
+//   Configuration
+// -----------------------------
+
+/** Maximum number of FIR taps (the state is allocated inline, no heap use). */
+#ifndef FIR_MAX_TAPS
+#define FIR_MAX_TAPS 128U
+#endif
+
+/** Number of output samples computed together in the main loop. */
+#define FIR_BLOCK 8U
+
+/** Samples converted per step by `array_fir_process_i16()`. */
+#define FIR_I16_CHUNK 256U
+
+// -----------------------------
+//   Type Definitions
+// -----------------------------
+
+/**
+ * @brief Streaming FIR filter state.
+ */
+typedef struct
+{
+    int16_t taps[FIR_MAX_TAPS];          /**< Coefficients in fixed point (frac_bits) */
+    size_t tap_count;                    /**< Number of taps */
+    unsigned frac_bits;                  /**< Fractional bits of the coefficients (0..15) */
+    bool symmetric;                      /**< taps[k] == taps[tap_count - 1 - k] for all k */
+    int32_t history[FIR_MAX_TAPS - 1U];  /**< Previous inputs, history[tap_count - 2] is newest */
+} array_fir_t;
+
+// -----------------------------
+//   Setup
+// -----------------------------
+
+/**
+ * @brief Clears the filter history (as if all previous inputs were 0).
+ *
+ * @param fir Pointer to an initialized filter.
+ */
+static inline void array_fir_reset(array_fir_t* fir)
+{
+    if (fir != NULL)
+    {
+        memset(fir->history, 0, sizeof(fir->history));
+    }
+}
+
+/**
+ * @brief Initializes a FIR filter with fixed-point coefficients.
+ *
+ * Symmetric (linear-phase) coefficient sets are detected here and later folded, so each pair of
+ * equal taps costs a single multiplication.
+ *
+ * @param fir       Pointer to the filter state.
+ * @param taps      Coefficients, e.g. in Q15 for `frac_bits = 15`.
+ * @param tap_count Number of coefficients (1..FIR_MAX_TAPS).
+ * @param frac_bits Fractional bits of the coefficients (0..15).
+ *
+ * @retval ARRAY_STATUS_OK                  Filter ready, history cleared.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         tap_count was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT tap_count > FIR_MAX_TAPS or frac_bits > 15.
+ */
+static inline array_status_t array_fir_init(array_fir_t* fir, const int16_t* taps,
+                                            size_t tap_count, unsigned frac_bits)
+{
+    if (fir == NULL || taps == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (tap_count == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if (tap_count > FIR_MAX_TAPS || frac_bits > 15U)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    memcpy(fir->taps, taps, tap_count * sizeof(int16_t));
+    fir->tap_count = tap_count;
+    fir->frac_bits = frac_bits;
+    fir->symmetric = true;
+
+    for (size_t k = 0U; k < tap_count / 2U; ++k)
+    {
+        if (taps[k] != taps[tap_count - 1U - k])
+        {
+            fir->symmetric = false;
+            break;
+        }
+    }
+
+    array_fir_reset(fir);
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Processing
+// -----------------------------
+
+/**
+ * @brief Rounds a fixed-point accumulator and saturates it to [min, max].
+ */
+static inline int32_t fir_finish(int64_t acc, unsigned frac_bits, int32_t min, int32_t max,
+                                 uint32_t* clamped)
+{
+    if (frac_bits > 0U)
+    {
+        acc = (acc + ((int64_t) 1 << (frac_bits - 1U))) >> frac_bits;
+    }
+
+    *clamped |= (uint32_t) ((acc < min) | (acc > max));
+    acc = (acc < min) ? min : acc;
+    acc = (acc > max) ? max : acc;
+    return (int32_t) acc;
+}
+
+/**
+ * @brief Filters a chunk of int32 samples and advances the filter state.
+ *
+ * The first `tap_count - 1` outputs read the stored history; all later outputs read only `in`
+ * and are computed `FIR_BLOCK` at a time with the tap loop outside, so the inner loop runs over
+ * consecutive output samples.
+ *
+ * @param fir  Pointer to an initialized filter.
+ * @param in   Input samples (must not overlap `out`).
+ * @param out  Output samples.
+ * @param size Number of samples in this chunk.
+ * @param type Range to clamp the output against.
+ *
+ * @retval ARRAY_STATUS_OK                     All outputs were in range.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more outputs were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Chunk size was 0.
+ */
+static inline array_status_t array_fir_process(array_fir_t* fir, const int32_t* in, int32_t* out,
+                                               size_t size, clamp_type_int_t type)
+{
+    if (fir == NULL || in == NULL || out == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    int32_t min = INT32_MIN;
+    int32_t max = INT32_MAX;
+    clamp_limits_int32(type, &min, &max);
+
+    const int16_t* taps = fir->taps;
+    const size_t tap_count = fir->tap_count;
+    const size_t hist_len = tap_count - 1U;
+    uint32_t clamped = 0U;
+    size_t n = 0U;
+
+    // Head: outputs that still need samples from the previous chunk
+    for (; n < hist_len && n < size; ++n)
+    {
+        int64_t acc = 0;
+        for (size_t k = 0U; k < tap_count; ++k)
+        {
+            int32_t x = (k <= n) ? in[n - k] : fir->history[hist_len + n - k];
+            acc += (int64_t) taps[k] * x;
+        }
+        out[n] = fir_finish(acc, fir->frac_bits, min, max, &clamped);
+    }
+
+    // Bulk: x[n + j - k] == base[j + hist_len - k] with base = &in[n - hist_len]
+    const size_t half = tap_count / 2U;
+
+    for (; n + FIR_BLOCK <= size; n += FIR_BLOCK)
+    {
+        const int32_t* base = &in[n - hist_len];
+        int64_t acc[FIR_BLOCK] = {0};
+
+        if (fir->symmetric)
+        {
+            for (size_t k = 0U; k < half; ++k)
+            {
+                const int64_t c = taps[k];
+                for (size_t j = 0U; j < FIR_BLOCK; ++j)
+                {
+                    acc[j] += c * ((int64_t) base[j + hist_len - k] + base[j + k]);
+                }
+            }
+
+            if ((tap_count & 1U) != 0U)
+            {
+                const int64_t c = taps[half];
+                for (size_t j = 0U; j < FIR_BLOCK; ++j)
+                {
+                    acc[j] += c * base[j + hist_len - half];
+                }
+            }
+        }
+        else
+        {
+            for (size_t k = 0U; k < tap_count; ++k)
+            {
+                const int64_t c = taps[k];
+                for (size_t j = 0U; j < FIR_BLOCK; ++j)
+                {
+                    acc[j] += c * base[j + hist_len - k];
+                }
+            }
+        }
+
+        for (size_t j = 0U; j < FIR_BLOCK; ++j)
+        {
+            out[n + j] = fir_finish(acc[j], fir->frac_bits, min, max, &clamped);
+        }
+    }
+
+    // Tail: remaining outputs (fewer than FIR_BLOCK)
+    for (; n < size; ++n)
+    {
+        int64_t acc = 0;
+        for (size_t k = 0U; k < tap_count; ++k)
+        {
+            acc += (int64_t) taps[k] * in[n - k];
+        }
+        out[n] = fir_finish(acc, fir->frac_bits, min, max, &clamped);
+    }
+
+    // Keep the newest hist_len inputs for the next chunk
+    if (size >= hist_len)
+    {
+        memcpy(fir->history, &in[size - hist_len], hist_len * sizeof(int32_t));
+    }
+    else
+    {
+        memmove(fir->history, &fir->history[size], (hist_len - size) * sizeof(int32_t));
+        memcpy(&fir->history[hist_len - size], in, size * sizeof(int32_t));
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Filters a chunk of int16 samples (saturating to CLAMP_INT16).
+ *
+ * Samples are widened in small cache-resident pieces and processed by `array_fir_process()`.
+ *
+ * @param fir  Pointer to an initialized filter.
+ * @param in   Input samples (must not overlap `out`).
+ * @param out  Output samples.
+ * @param size Number of samples in this chunk.
+ *
+ * @retval ARRAY_STATUS_OK                     All outputs were in range.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more outputs were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Chunk size was 0.
+ */
+static inline array_status_t array_fir_process_i16(array_fir_t* fir, const int16_t* in,
+                                                   int16_t* out, size_t size)
+{
+    if (fir == NULL || in == NULL || out == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    int32_t wide_in[FIR_I16_CHUNK];
+    int32_t wide_out[FIR_I16_CHUNK];
+    bool clamped = false;
+
+    for (size_t base = 0U; base < size; base += FIR_I16_CHUNK)
+    {
+        size_t count = (size - base < FIR_I16_CHUNK) ? size - base : FIR_I16_CHUNK;
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+            wide_in[i] = in[base + i];
+        }
+
+        if (array_fir_process(fir, wide_in, wide_out, count, CLAMP_INT16) ==
+            ARRAY_STATUS_WARNING_OVERFLOW_CLAMP)
+        {
+            clamped = true;
+        }
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+            out[base + i] = (int16_t) wide_out[i];
+        }
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+#endif // ARRAY_NOISE_H
@@ -0,0 +1,620 @@
+/**
+ * @file array_parallel.h
+ * @brief Parallel chunked execution of `array_transform.h` operations on a worker pool.
+ *
+ * Large arrays are split into chunks whose boundaries fall on cache-line boundaries, so no two
+ * threads write to the same cache line. Chunks are handed out dynamically to a persistent pool
+ * of worker threads plus the calling thread. Arrays smaller than the pool's minimum grain are
+ * processed serially on the calling thread.
+ *
+ * Define `ARRAY_PARALLEL_NO_THREADS` on targets without POSIX threads: the API stays the same and
+ * every call runs serially.
+ *
+ * @note A pool must not be used by more than one calling thread at a time.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_PARALLEL_H
+#define ARRAY_PARALLEL_H
+
+#include "array_transform.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef ARRAY_PARALLEL_NO_THREADS
+#include <pthread.h>
+#endif
+
+// -----------------------------
+//   Configuration
+// -----------------------------
+
+/** Maximum number of worker threads in a pool (the calling thread is not counted). */
+#ifndef ARRAY_PARALLEL_MAX_THREADS
+#define ARRAY_PARALLEL_MAX_THREADS 64U
+#endif
+
+/** Default minimum number of elements per chunk; smaller arrays stay serial. */
+#ifndef ARRAY_PARALLEL_DEFAULT_MIN_GRAIN
+#define ARRAY_PARALLEL_DEFAULT_MIN_GRAIN 65536U
+#endif
+
+/** Cache line size used to align chunk boundaries. */
+#ifndef ARRAY_PARALLEL_CACHE_LINE
+#define ARRAY_PARALLEL_CACHE_LINE 64U
+#endif
+
+/** Target number of chunks per participating thread (for load balancing). */
+#define ARRAY_PARALLEL_CHUNKS_PER_THREAD 4U
+
+// -----------------------------
+//   Type Definitions
+// -----------------------------
+
+/**
+ * @brief Processes elements [begin, end) of a parallel task.
+ */
+typedef array_status_t (*array_parallel_chunk_fn)(const void* task, size_t begin, size_t end);
+
+/**
+ * @brief Persistent worker pool executing chunked array operations.
+ */
+typedef struct
+{
+    size_t thread_count; /**< Number of worker threads (the caller also participates) */
+    size_t min_grain;    /**< Minimum elements per chunk; tune for the target machine */
+
+#ifndef ARRAY_PARALLEL_NO_THREADS
+    pthread_t threads[ARRAY_PARALLEL_MAX_THREADS];
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready;
+    pthread_cond_t work_done;
+
+    // Current job (protected by `lock`)
+    array_parallel_chunk_fn fn;
+    const void* task;
+    size_t size;
+    size_t head;  /**< Elements before the first cache-line-aligned boundary */
+    size_t chunk; /**< Elements per chunk (multiple of a cache line) */
+    size_t chunk_count;
+    size_t next_chunk;
+    size_t chunks_done;
+    unsigned generation;
+    bool clamped;
+    bool shutdown;
+#endif
+} array_parallel_pool_t;
+
+/**
+ * @brief Arguments of a parallel transform, shared by all chunks.
+ */
+typedef struct
+{
+    void* array;    /**< int32_t* or uint32_t* depending on the operation */
+    int64_t arg0;   /**< Offset, factor or lower bound */
+    int64_t arg1;   /**< Upper bound (clamp only) */
+    int clamp_type; /**< clamp_type_int_t or clamp_type_uint_t */
+} array_parallel_task_t;
+
+// -----------------------------
+//   Chunk planning
+// -----------------------------
+
+/**
+ * @brief Start index of chunk `k`; chunk `k` covers [start(k), start(k + 1)).
+ *
+ * Every boundary except the first is `head + k * chunk`, so it lies on a cache line.
+ */
+static inline size_t array_parallel_chunk_start(size_t k, size_t size, size_t head, size_t chunk)
+{
+    if (k == 0U)
+    {
+        return 0U;
+    }
+
+    size_t start = head + k * chunk;
+    return (start < size) ? start : size;
+}
+
+/**
+ * @brief Computes cache-line-aligned chunking for an array of `size` elements.
+ *
+ * @param base         Address of the first element.
+ * @param size         Number of elements.
+ * @param elem_size    Size of one element in bytes.
+ * @param participants Number of threads taking part (workers + caller).
+ * @param min_grain    Minimum elements per chunk.
+ * @param out_head     Elements before the first aligned boundary.
+ * @param out_chunk    Elements per chunk (multiple of a cache line).
+ *
+ * @return Number of chunks (1 means the operation should run serially).
+ */
+static inline size_t array_parallel_plan(const void* base, size_t size, size_t elem_size,
+                                         size_t participants, size_t min_grain, size_t* out_head,
+                                         size_t* out_chunk)
+{
+    const size_t line_elems = ARRAY_PARALLEL_CACHE_LINE / elem_size;
+    const size_t misalign = (size_t) ((uintptr_t) base % ARRAY_PARALLEL_CACHE_LINE);
+
+    size_t head = (misalign == 0U) ? 0U : (ARRAY_PARALLEL_CACHE_LINE - misalign) / elem_size;
+    size_t chunk = size / (participants * ARRAY_PARALLEL_CHUNKS_PER_THREAD);
+
+    chunk = (chunk < min_grain) ? min_grain : chunk;
+    chunk = ((chunk + line_elems - 1U) / line_elems) * line_elems;
+
+    *out_head = head;
+    *out_chunk = chunk;
+
+    if (participants < 2U || size < 2U * chunk || head >= size)
+    {
+        return 1U;
+    }
+
+    // Chunk 0 is [0, head + chunk); the rest are full chunks except possibly the last
+    size_t rest = size - head - chunk;
+    return 1U + (rest + chunk - 1U) / chunk;
+}
+
+// -----------------------------
+//   Worker pool
+// -----------------------------
+
+#ifndef ARRAY_PARALLEL_NO_THREADS
+
+/**
+ * @brief Runs chunks of the current job until none are left. Must be called with `lock` held.
+ */
+static inline void array_parallel_run_chunks(array_parallel_pool_t* pool)
+{
+    while (pool->next_chunk < pool->chunk_count)
+    {
+        size_t k = pool->next_chunk++;
+        size_t begin = array_parallel_chunk_start(k, pool->size, pool->head, pool->chunk);
+        size_t end = array_parallel_chunk_start(k + 1U, pool->size, pool->head, pool->chunk);
+        array_parallel_chunk_fn fn = pool->fn;
+        const void* task = pool->task;
+
+        pthread_mutex_unlock(&pool->lock);
+        array_status_t status = fn(task, begin, end);
+        pthread_mutex_lock(&pool->lock);
+
+        pool->clamped = pool->clamped || (status == ARRAY_STATUS_WARNING_OVERFLOW_CLAMP);
+        if (++pool->chunks_done == pool->chunk_count)
+        {
+            pthread_cond_signal(&pool->work_done);
+        }
+    }
+}
+
+/**
+ * @brief Worker thread entry: waits for a new job generation and helps process it.
+ */
+static inline void* array_parallel_worker(void* arg)
+{
+    array_parallel_pool_t* pool = (array_parallel_pool_t*) arg;
+
+    unsigned seen = 0U; // generation at pool creation
+
+    pthread_mutex_lock(&pool->lock);
+
+    for (;;)
+    {
+        while (!pool->shutdown && seen == pool->generation)
+        {
+            pthread_cond_wait(&pool->work_ready, &pool->lock);
+        }
+
+        if (pool->shutdown)
+        {
+            break;
+        }
+
+        seen = pool->generation;
+        array_parallel_run_chunks(pool);
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+#endif // ARRAY_PARALLEL_NO_THREADS
+
+/**
+ * @brief Initializes a worker pool and starts its threads.
+ *
+ * If a thread cannot be created, the pool keeps running with the threads started so far. If the
+ * pool's mutex or condition variables cannot be initialized, nothing is left allocated and the
+ * pool must not be used or destroyed.
+ *
+ * @param pool         Pointer to the pool to initialize.
+ * @param thread_count Number of worker threads to start (0 runs everything serially).
+ *
+ * @retval ARRAY_STATUS_OK                  Pool ready (check `pool->thread_count`).
+ * @retval ARRAY_STATUS_ERROR_NULL          Pool pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT thread_count > ARRAY_PARALLEL_MAX_THREADS.
+ * @retval ARRAY_STATUS_ERROR_RESOURCE      Mutex or condition variable initialization failed.
+ */
+static inline array_status_t array_parallel_pool_init(array_parallel_pool_t* pool,
+                                                      size_t thread_count)
+{
+    if (pool == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (thread_count > ARRAY_PARALLEL_MAX_THREADS)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    pool->thread_count = 0U;
+    pool->min_grain = ARRAY_PARALLEL_DEFAULT_MIN_GRAIN;
+
+#ifndef ARRAY_PARALLEL_NO_THREADS
+    if (pthread_mutex_init(&pool->lock, NULL) != 0)
+    {
+        return ARRAY_STATUS_ERROR_RESOURCE;
+    }
+
+    if (pthread_cond_init(&pool->work_ready, NULL) != 0)
+    {
+        pthread_mutex_destroy(&pool->lock);
+        return ARRAY_STATUS_ERROR_RESOURCE;
+    }
+
+    if (pthread_cond_init(&pool->work_done, NULL) != 0)
+    {
+        pthread_cond_destroy(&pool->work_ready);
+        pthread_mutex_destroy(&pool->lock);
+        return ARRAY_STATUS_ERROR_RESOURCE;
+    }
+
+    pool->fn = NULL;
+    pool->task = NULL;
+    pool->chunk_count = 0U;
+    pool->next_chunk = 0U;
+    pool->chunks_done = 0U;
+    pool->generation = 0U;
+    pool->clamped = false;
+    pool->shutdown = false;
+
+    for (size_t i = 0U; i < thread_count; ++i)
+    {
+        if (pthread_create(&pool->threads[i], NULL, array_parallel_worker, pool) != 0)
+        {
+            break;
+        }
+        pool->thread_count++;
+    }
+#else
+    (void) thread_count;
+#endif
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Stops and joins all worker threads of a pool.
+ *
+ * @param pool Pointer to an initialized pool.
+ */
+static inline void array_parallel_pool_destroy(array_parallel_pool_t* pool)
+{
+    if (pool == NULL)
+    {
+        return;
+    }
+
+#ifndef ARRAY_PARALLEL_NO_THREADS
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = true;
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (size_t i = 0U; i < pool->thread_count; ++i)
+    {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->work_done);
+    pthread_cond_destroy(&pool->work_ready);
+    pthread_mutex_destroy(&pool->lock);
+#endif
+
+    pool->thread_count = 0U;
+}
+
+/**
+ * @brief Runs `fn` over [0, size) in cache-line-aligned chunks on the pool.
+ *
+ * Falls back to a single serial call when the pool is NULL, has no workers, or the array is
+ * smaller than two chunks of `min_grain` elements. Clamp warnings of all chunks are OR-ed.
+ *
+ * @param pool      Worker pool (may be NULL for serial execution).
+ * @param fn        Chunk function.
+ * @param task      Task arguments passed to every chunk.
+ * @param base      Address of the first element (used for alignment).
+ * @param size      Number of elements.
+ * @param elem_size Size of one element in bytes.
+ *
+ * @retval ARRAY_STATUS_OK                     No chunk clamped.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP At least one chunk clamped.
+ */
+static inline array_status_t array_parallel_for(array_parallel_pool_t* pool,
+                                                array_parallel_chunk_fn fn, const void* task,
+                                                const void* base, size_t size, size_t elem_size)
+{
+    if (pool == NULL || pool->thread_count == 0U)
+    {
+        return fn(task, 0U, size);
+    }
+
+#ifndef ARRAY_PARALLEL_NO_THREADS
+    size_t head = 0U;
+    size_t chunk = 0U;
+    size_t count = array_parallel_plan(base, size, elem_size, pool->thread_count + 1U,
+                                       pool->min_grain, &head, &chunk);
+
+    if (count < 2U)
+    {
+        return fn(task, 0U, size);
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->fn = fn;
+    pool->task = task;
+    pool->size = size;
+    pool->head = head;
+    pool->chunk = chunk;
+    pool->chunk_count = count;
+    pool->next_chunk = 0U;
+    pool->chunks_done = 0U;
+    pool->clamped = false;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->work_ready);
+
+    array_parallel_run_chunks(pool);
+    while (pool->chunks_done < pool->chunk_count)
+    {
+        pthread_cond_wait(&pool->work_done, &pool->lock);
+    }
+
+    bool clamped = pool->clamped;
+    pthread_mutex_unlock(&pool->lock);
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+#else
+    (void) base;
+    (void) elem_size;
+    return fn(task, 0U, size);
+#endif
+}
+
+// -----------------------------
+//   Chunk kernels
+// -----------------------------
+
+static inline array_status_t array_parallel_clamp_chunk(const void* task, size_t begin, size_t end)
+{
+    const array_parallel_task_t* t = (const array_parallel_task_t*) task;
+    size_t count = 0U;
+    array_clamp_report((int32_t*) t->array + begin, end - begin, (int32_t) t->arg0,
+                       (int32_t) t->arg1, &count, NULL);
+    return (count != 0U) ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+static inline array_status_t array_parallel_offset_chunk(const void* task, size_t begin,
+                                                         size_t end)
+{
+    const array_parallel_task_t* t = (const array_parallel_task_t*) task;
+    return array_offset((int32_t*) t->array + begin, end - begin, (int32_t) t->arg0,
+                        (clamp_type_int_t) t->clamp_type);
+}
+
+static inline array_status_t array_parallel_offset_uint_chunk(const void* task, size_t begin,
+                                                              size_t end)
+{
+    const array_parallel_task_t* t = (const array_parallel_task_t*) task;
+    return array_offset_uint((uint32_t*) t->array + begin, end - begin, (uint32_t) t->arg0,
+                             (clamp_type_uint_t) t->clamp_type);
+}
+
+static inline array_status_t array_parallel_scale_chunk(const void* task, size_t begin, size_t end)
+{
+    const array_parallel_task_t* t = (const array_parallel_task_t*) task;
+    return array_scale((int32_t*) t->array + begin, end - begin, (int32_t) t->arg0,
+                       (clamp_type_int_t) t->clamp_type);
+}
+
+static inline array_status_t array_parallel_scale_uint_chunk(const void* task, size_t begin,
+                                                             size_t end)
+{
+    const array_parallel_task_t* t = (const array_parallel_task_t*) task;
+    return array_scale_uint((uint32_t*) t->array + begin, end - begin, (uint32_t) t->arg0,
+                            (clamp_type_uint_t) t->clamp_type);
+}
+
+// -----------------------------
+//   Parallel transforms
+// -----------------------------
+
+/**
+ * @brief Parallel version of `array_clamp()`.
+ *
+ * Unlike `array_clamp()`, reports ARRAY_STATUS_WARNING_OVERFLOW_CLAMP if any element was
+ * clamped, since the per-chunk flags are collected anyway.
+ *
+ * @param pool  Worker pool (may be NULL for serial execution).
+ * @param array Pointer to the array to clamp (modified in-place).
+ * @param size  Number of elements in the array.
+ * @param min   Lower bound.
+ * @param max   Upper bound.
+ *
+ * @retval ARRAY_STATUS_OK                     No element was clamped.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    min > max.
+ */
+static inline array_status_t array_clamp_parallel(array_parallel_pool_t* pool, int32_t* array,
+                                                  size_t size, int32_t min, int32_t max)
+{
+    if (array == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+    if (min > max)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    array_parallel_task_t task = {array, min, max, 0};
+    return array_parallel_for(pool, array_parallel_clamp_chunk, &task, array, size,
+                              sizeof(int32_t));
+}
+
+/**
+ * @brief Parallel version of `array_offset()`.
+ *
+ * @param pool   Worker pool (may be NULL for serial execution).
+ * @param array  Pointer to the array to offset (modified in-place).
+ * @param size   Number of elements in the array.
+ * @param offset The value to add to each element.
+ * @param type   Range to clamp against.
+ *
+ * @retval ARRAY_STATUS_OK                     All additions completed successfully.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_WARNING_OFFSET_IS_ZERO No operation performed, offset was 0.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_offset_parallel(array_parallel_pool_t* pool, int32_t* array,
+                                                   size_t size, int32_t offset,
+                                                   clamp_type_int_t type)
+{
+    if (array == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+    if (offset == 0)
+    {
+        return ARRAY_STATUS_WARNING_OFFSET_IS_ZERO;
+    }
+
+    array_parallel_task_t task = {array, offset, 0, (int) type};
+    return array_parallel_for(pool, array_parallel_offset_chunk, &task, array, size,
+                              sizeof(int32_t));
+}
+
+/**
+ * @brief Parallel version of `array_offset_uint()`.
+ *
+ * @param pool   Worker pool (may be NULL for serial execution).
+ * @param array  Pointer to the unsigned array to offset (modified in-place).
+ * @param size   Number of elements in the array.
+ * @param offset The unsigned value to add to each element.
+ * @param type   The clamp limit type (UINT8, UINT16, UINT32).
+ *
+ * @retval ARRAY_STATUS_OK                     All additions were successful.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_WARNING_OFFSET_IS_ZERO Offset was zero, no operation performed.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer is NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size is zero.
+ */
+static inline array_status_t array_offset_uint_parallel(array_parallel_pool_t* pool,
+                                                        uint32_t* array, size_t size,
+                                                        uint32_t offset, clamp_type_uint_t type)
+{
+    if (array == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+    if (offset == 0U)
+    {
+        return ARRAY_STATUS_WARNING_OFFSET_IS_ZERO;
+    }
+
+    array_parallel_task_t task = {array, offset, 0, (int) type};
+    return array_parallel_for(pool, array_parallel_offset_uint_chunk, &task, array, size,
+                              sizeof(uint32_t));
+}
+
+/**
+ * @brief Parallel version of `array_scale()`.
+ *
+ * @param pool   Worker pool (may be NULL for serial execution).
+ * @param array  Pointer to the array to scale (modified in-place).
+ * @param size   Number of elements in the array.
+ * @param factor Multiplication factor.
+ * @param type   Range to clamp against.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements scaled successfully.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_scale_parallel(array_parallel_pool_t* pool, int32_t* array,
+                                                  size_t size, int32_t factor,
+                                                  clamp_type_int_t type)
+{
+    if (array == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    array_parallel_task_t task = {array, factor, 0, (int) type};
+    return array_parallel_for(pool, array_parallel_scale_chunk, &task, array, size,
+                              sizeof(int32_t));
+}
+
+/**
+ * @brief Parallel version of `array_scale_uint()`.
+ *
+ * @param pool   Worker pool (may be NULL for serial execution).
+ * @param array  Pointer to the unsigned array to scale (modified in-place).
+ * @param size   Number of elements in the array.
+ * @param factor Multiplication factor.
+ * @param type   Unsigned integer range to clamp against.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements scaled successfully.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             Null pointer input.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Zero-length array.
+ */
+static inline array_status_t array_scale_uint_parallel(array_parallel_pool_t* pool,
+                                                       uint32_t* array, size_t size,
+                                                       uint32_t factor, clamp_type_uint_t type)
+{
+    if (array == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    array_parallel_task_t task = {array, factor, 0, (int) type};
+    return array_parallel_for(pool, array_parallel_scale_uint_chunk, &task, array, size,
+                              sizeof(uint32_t));
+}
+
+#endif // ARRAY_PARALLEL_H
@@ -0,0 +1,489 @@
+/**
+ * @file array_quant.h
+ * @brief Affine float <-> int8 / uint8 quantization with scale and zero point.
+ *
+ * Quantization computes `q = round(x / scale) + zero_point` with round-to-nearest-even and
+ * saturates `q` to the CLAMP_INT8 / CLAMP_UINT8 range; dequantization computes
+ * `x = (q - zero_point) * scale`. Per-channel kernels use one parameter set per channel of
+ * interleaved data (element `i` belongs to channel `i % channels`).
+ *
+ * @note Rounding uses the `1.5 * 2^23` magic-number trick instead of `lrintf()`, so the loops
+ *       need no libm call and vectorize. It requires the default FP rounding mode and must not
+ *       be compiled with `-ffast-math`.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_QUANT_H
+#define ARRAY_QUANT_H
+
+#include "array_transform.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------
+//   Type Definitions
+// -----------------------------
+
+/**
+ * @brief Affine quantization parameters.
+ */
+typedef struct
+{
+    float scale;        /**< Real value of one quantization step (> 0, finite) */
+    int32_t zero_point; /**< Quantized value that represents 0.0f */
+} quant_params_t;
+
+// -----------------------------
+//   Helpers
+// -----------------------------
+
+/** Channels whose parameters are precomputed together by the per-channel kernels. */
+#define QUANT_CHANNEL_TILE 64U
+
+/** Adding and subtracting 1.5 * 2^23 rounds any |x| < 2^22 to the nearest even integer. */
+#define QUANT_ROUND_MAGIC 12582912.0f
+
+/**
+ * @brief Checks that a parameter set is usable for the range [qmin, qmax].
+ */
+static inline bool quant_params_valid(quant_params_t params, int32_t qmin, int32_t qmax)
+{
+    // Written as positive comparisons so NaN is rejected as well
+    return (params.scale > 0.0f) && (params.scale <= 3.402823466e+38f) &&
+           (params.zero_point >= qmin) && (params.zero_point <= qmax);
+}
+
+/**
+ * @brief Quantizes one value: divide by scale, round half to even, add zero point and saturate.
+ *
+ * `x / scale` is rounded on its own and the zero point is added as an integer, so ties do not
+ * depend on the zero point. The quotient is first limited to [lo - zp - 1, hi - zp + 1] so the
+ * magic-number trick never sees a large value; only results outside [lo, hi] count as saturated.
+ * NaN inputs map to `lo` and count as saturated.
+ */
+static inline int32_t quant_one(float x, float scale, int32_t zero_point, int32_t lo, int32_t hi,
+                                uint32_t* clamped)
+{
+    const float below = (float) (lo - zero_point - 1);
+    const float above = (float) (hi - zero_point + 1);
+    float v = x / scale;
+    uint32_t nan = (uint32_t) !(v == v);
+
+    v = (v >= below) ? v : below;
+    v = (v > above) ? above : v;
+    v = (v + QUANT_ROUND_MAGIC) - QUANT_ROUND_MAGIC;
+
+    int32_t q = (int32_t) v + zero_point;
+    *clamped |= nan | (uint32_t) (q < lo) | (uint32_t) (q > hi);
+    q = (q < lo) ? lo : q;
+    q = (q > hi) ? hi : q;
+    return q;
+}
+
+/**
+ * @brief Validates the buffers common to all quantization kernels.
+ */
+static inline array_status_t quant_check(const void* src, const void* dst, size_t size)
+{
+    if (src == NULL || dst == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Per-tensor Quantization
+// -----------------------------
+
+/**
+ * @brief Quantizes a float array to int8 with a single scale / zero point.
+ *
+ * @param src    Input array.
+ * @param dst    Output array.
+ * @param size   Number of elements.
+ * @param params Quantization parameters (zero_point within CLAMP_INT8).
+ *
+ * @retval ARRAY_STATUS_OK                     All values were representable.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were saturated (or NaN).
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    Scale or zero point is not valid.
+ */
+static inline array_status_t array_quantize_int8(const float* src, int8_t* dst, size_t size,
+                                                 quant_params_t params)
+{
+    array_status_t status = quant_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    if (!quant_params_valid(params, INT8_MIN, INT8_MAX))
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    const float scale = params.scale;
+    const int32_t zero_point = params.zero_point;
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        dst[i] = (int8_t) quant_one(src[i], scale, zero_point, INT8_MIN, INT8_MAX, &clamped);
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Quantizes a float array to uint8 with a single scale / zero point.
+ *
+ * @param src    Input array.
+ * @param dst    Output array.
+ * @param size   Number of elements.
+ * @param params Quantization parameters (zero_point within CLAMP_UINT8).
+ *
+ * @retval ARRAY_STATUS_OK                     All values were representable.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were saturated (or NaN).
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    Scale or zero point is not valid.
+ */
+static inline array_status_t array_quantize_uint8(const float* src, uint8_t* dst, size_t size,
+                                                  quant_params_t params)
+{
+    array_status_t status = quant_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    if (!quant_params_valid(params, 0, UINT8_MAX))
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    const float scale = params.scale;
+    const int32_t zero_point = params.zero_point;
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        dst[i] = (uint8_t) quant_one(src[i], scale, zero_point, 0, UINT8_MAX, &clamped);
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Dequantizes an int8 array back to float.
+ *
+ * @param src    Input array.
+ * @param dst    Output array.
+ * @param size   Number of elements.
+ * @param params Quantization parameters used for `src`.
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT Scale or zero point is not valid.
+ */
+static inline array_status_t array_dequantize_int8(const int8_t* src, float* dst, size_t size,
+                                                   quant_params_t params)
+{
+    array_status_t status = quant_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    if (!quant_params_valid(params, INT8_MIN, INT8_MAX))
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        dst[i] = (float) ((int32_t) src[i] - params.zero_point) * params.scale;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Dequantizes a uint8 array back to float.
+ *
+ * @param src    Input array.
+ * @param dst    Output array.
+ * @param size   Number of elements.
+ * @param params Quantization parameters used for `src`.
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT Scale or zero point is not valid.
+ */
+static inline array_status_t array_dequantize_uint8(const uint8_t* src, float* dst, size_t size,
+                                                    quant_params_t params)
+{
+    array_status_t status = quant_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    if (!quant_params_valid(params, 0, UINT8_MAX))
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        dst[i] = (float) ((int32_t) src[i] - params.zero_point) * params.scale;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Per-channel Quantization
+// -----------------------------
+
+/**
+ * @brief Quantizes interleaved float data to int8 with one parameter set per channel.
+ *
+ * @param src      Input array, `size / channels` frames of `channels` values.
+ * @param dst      Output array.
+ * @param size     Number of elements (multiple of `channels`).
+ * @param params   Array of `channels` parameter sets.
+ * @param channels Number of channels.
+ *
+ * @retval ARRAY_STATUS_OK                     All values were representable.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were saturated (or NaN).
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size or channel count was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    Bad parameters or size not a multiple of channels.
+ */
+static inline array_status_t array_quantize_int8_per_channel(const float* src, int8_t* dst,
+                                                             size_t size,
+                                                             const quant_params_t* params,
+                                                             size_t channels)
+{
+    array_status_t status = quant_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    if (params == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (channels == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if (size % channels != 0U)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    for (size_t c = 0U; c < channels; ++c)
+    {
+        if (!quant_params_valid(params[c], INT8_MIN, INT8_MAX))
+        {
+            return ARRAY_STATUS_ERROR_INVALID_INPUT;
+        }
+    }
+
+    uint32_t clamped = 0U;
+
+    // Frames outside, channels inside: src / dst are read and written once, in order. Channel
+    // parameters are precomputed per group of QUANT_CHANNEL_TILE channels.
+    for (size_t c0 = 0U; c0 < channels; c0 += QUANT_CHANNEL_TILE)
+    {
+        const size_t group =
+            (channels - c0 < QUANT_CHANNEL_TILE) ? channels - c0 : QUANT_CHANNEL_TILE;
+        float scale[QUANT_CHANNEL_TILE];
+        int32_t zero_point[QUANT_CHANNEL_TILE];
+
+        for (size_t c = 0U; c < group; ++c)
+        {
+            scale[c] = params[c0 + c].scale;
+            zero_point[c] = params[c0 + c].zero_point;
+        }
+
+        for (size_t base = c0; base < size; base += channels)
+        {
+            for (size_t c = 0U; c < group; ++c)
+            {
+                dst[base + c] = (int8_t) quant_one(src[base + c], scale[c], zero_point[c],
+                                                   INT8_MIN, INT8_MAX, &clamped);
+            }
+        }
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Quantizes interleaved float data to uint8 with one parameter set per channel.
+ *
+ * @param src      Input array, `size / channels` frames of `channels` values.
+ * @param dst      Output array.
+ * @param size     Number of elements (multiple of `channels`).
+ * @param params   Array of `channels` parameter sets.
+ * @param channels Number of channels.
+ *
+ * @retval ARRAY_STATUS_OK                     All values were representable.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were saturated (or NaN).
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size or channel count was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    Bad parameters or size not a multiple of channels.
+ */
+static inline array_status_t array_quantize_uint8_per_channel(const float* src, uint8_t* dst,
+                                                              size_t size,
+                                                              const quant_params_t* params,
+                                                              size_t channels)
+{
+    array_status_t status = quant_check(src, dst, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    if (params == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (channels == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if (size % channels != 0U)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    for (size_t c = 0U; c < channels; ++c)
+    {
+        if (!quant_params_valid(params[c], 0, UINT8_MAX))
+        {
+            return ARRAY_STATUS_ERROR_INVALID_INPUT;
+        }
+    }
+
+    uint32_t clamped = 0U;
+
+    // Frames outside, channels inside: src / dst are read and written once, in order. Channel
+    // parameters are precomputed per group of QUANT_CHANNEL_TILE channels.
+    for (size_t c0 = 0U; c0 < channels; c0 += QUANT_CHANNEL_TILE)
+    {
+        const size_t group =
+            (channels - c0 < QUANT_CHANNEL_TILE) ? channels - c0 : QUANT_CHANNEL_TILE;
+        float scale[QUANT_CHANNEL_TILE];
+        int32_t zero_point[QUANT_CHANNEL_TILE];
+
+        for (size_t c = 0U; c < group; ++c)
+        {
+            scale[c] = params[c0 + c].scale;
+            zero_point[c] = params[c0 + c].zero_point;
+        }
+
+        for (size_t base = c0; base < size; base += channels)
+        {
+            for (size_t c = 0U; c < group; ++c)
+            {
+                dst[base + c] = (uint8_t) quant_one(src[base + c], scale[c], zero_point[c],
+                                                    0, UINT8_MAX, &clamped);
+            }
+        }
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Calibration
+// -----------------------------
+
+/**
+ * @brief Derives scale and zero point so that [min(src), max(src)] maps onto [qmin, qmax].
+ *
+ * Min and max are found in a single fused pass. The range is widened to include 0.0f so that
+ * zero is exactly representable (required for zero padding).
+ *
+ * @param src        Input array.
+ * @param size       Number of elements.
+ * @param qmin       Lowest quantized value (e.g. INT8_MIN).
+ * @param qmax       Highest quantized value (e.g. INT8_MAX), greater than qmin.
+ * @param out_params Pointer where the parameters will be stored.
+ *
+ * @retval ARRAY_STATUS_OK                  Parameters stored.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT qmin >= qmax, or input contains NaN / infinity.
+ */
+static inline array_status_t array_quant_calibrate(const float* src, size_t size, int32_t qmin,
+                                                   int32_t qmax, quant_params_t* out_params)
+{
+    array_status_t status = quant_check(src, out_params, size);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    if (qmin >= qmax)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    float min = 0.0f;
+    float max = 0.0f;
+    uint32_t bad = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        float v = src[i];
+        // Non-finite values (NaN, +-inf) fail the range test
+        bad |= (uint32_t) !((v >= -3.402823466e+38f) & (v <= 3.402823466e+38f));
+        min = (v < min) ? v : min;
+        max = (v > max) ? v : max;
+    }
+
+    if (bad)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    float scale = (float) (((double) max - (double) min) / (double) (qmax - qmin));
+    if (!(scale > 0.0f))
+    {
+        // All zeros (or range below float resolution)
+        scale = 1.0f;
+    }
+
+    float zp = (float) qmin - min / scale;
+    zp = (zp + QUANT_ROUND_MAGIC) - QUANT_ROUND_MAGIC;
+    zp = (zp < (float) qmin) ? (float) qmin : zp;
+    zp = (zp > (float) qmax) ? (float) qmax : zp;
+
+    out_params->scale = scale;
+    out_params->zero_point = (int32_t) zp;
+    return ARRAY_STATUS_OK;
+}
+
+#endif // ARRAY_QUANT_H
@@ -0,0 +1,319 @@
+/**
+ * @file array_search.h
+ * @brief Find first / last occurrence, first element above / below a threshold, and threshold
+ *        crossings (rising / falling edges).
+ *
+ * The array is scanned in blocks of `SEARCH_BLOCK` elements. Inside a block the predicate is
+ * OR-reduced without branches (a loop the compiler vectorizes), and only the block that contains
+ * a hit is scanned again to locate the exact index. The search therefore exits early like a plain
+ * loop but pays one branch per block instead of one per element.
+ *
+ * When nothing is found, the index output is set to `size`.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_SEARCH_H
+#define ARRAY_SEARCH_H
+
+#include "array_filter.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------
+//   Configuration
+// -----------------------------
+
+/** Elements per block between two early-exit checks. */
+#define SEARCH_BLOCK 64U
+
+// -----------------------------
+//   Type Definitions
+// -----------------------------
+
+/**
+ * @brief Kind of threshold crossing.
+ */
+typedef enum
+{
+    SEARCH_EDGE_RISING,  /**< array[i - 1] < threshold <= array[i] */
+    SEARCH_EDGE_FALLING, /**< array[i - 1] >= threshold > array[i] */
+    SEARCH_EDGE_ANY      /**< Either of the above */
+} search_edge_t;
+
+// -----------------------------
+//   Helpers
+// -----------------------------
+
+/**
+ * @brief Validates the common arguments of all search kernels.
+ */
+static inline array_status_t search_check(const int32_t* array, size_t size,
+                                          const size_t* out_index)
+{
+    if (array == NULL || out_index == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief First index matching `pred`, or `size`; `pred` is a constant at every call site.
+ */
+static inline size_t search_forward(const int32_t* array, size_t size, filter_pred_t pred,
+                                    int32_t a)
+{
+    for (size_t base = 0U; base < size; base += SEARCH_BLOCK)
+    {
+        size_t end = (size - base < SEARCH_BLOCK) ? size : base + SEARCH_BLOCK;
+        uint32_t hit = 0U;
+
+        for (size_t i = base; i < end; ++i)
+        {
+            hit |= filter_match(array[i], pred, a, 0);
+        }
+
+        if (hit)
+        {
+            for (size_t i = base; i < end; ++i)
+            {
+                if (filter_match(array[i], pred, a, 0))
+                {
+                    return i;
+                }
+            }
+        }
+    }
+
+    return size;
+}
+
+/**
+ * @brief Last index matching `pred`, or `size`.
+ */
+static inline size_t search_backward(const int32_t* array, size_t size, filter_pred_t pred,
+                                     int32_t a)
+{
+    size_t end = size;
+
+    while (end > 0U)
+    {
+        size_t base = (end < SEARCH_BLOCK) ? 0U : end - SEARCH_BLOCK;
+        uint32_t hit = 0U;
+
+        for (size_t i = base; i < end; ++i)
+        {
+            hit |= filter_match(array[i], pred, a, 0);
+        }
+
+        if (hit)
+        {
+            for (size_t i = end; i-- > base;)
+            {
+                if (filter_match(array[i], pred, a, 0))
+                {
+                    return i;
+                }
+            }
+        }
+
+        end = base;
+    }
+
+    return size;
+}
+
+/**
+ * @brief Returns 1 if the step from `prev` to `cur` is a crossing of kind `edge`.
+ */
+static inline uint32_t search_edge_match(int32_t prev, int32_t cur, int32_t threshold,
+                                         search_edge_t edge)
+{
+    uint32_t rising = (uint32_t) (prev < threshold) & (uint32_t) (cur >= threshold);
+    uint32_t falling = (uint32_t) (prev >= threshold) & (uint32_t) (cur < threshold);
+
+    switch (edge)
+    {
+    case SEARCH_EDGE_RISING:
+        return rising;
+    case SEARCH_EDGE_FALLING:
+        return falling;
+    default:
+        return rising | falling;
+    }
+}
+
+/**
+ * @brief First index `i >= 1` where a crossing of kind `edge` ends, or `size`.
+ */
+static inline size_t search_crossing(const int32_t* array, size_t size, int32_t threshold,
+                                     search_edge_t edge)
+{
+    for (size_t base = 1U; base < size; base += SEARCH_BLOCK)
+    {
+        size_t end = (size - base < SEARCH_BLOCK) ? size : base + SEARCH_BLOCK;
+        uint32_t hit = 0U;
+
+        for (size_t i = base; i < end; ++i)
+        {
+            hit |= search_edge_match(array[i - 1U], array[i], threshold, edge);
+        }
+
+        if (hit)
+        {
+            for (size_t i = base; i < end; ++i)
+            {
+                if (search_edge_match(array[i - 1U], array[i], threshold, edge))
+                {
+                    return i;
+                }
+            }
+        }
+    }
+
+    return size;
+}
+
+// -----------------------------
+//   Occurrence
+// -----------------------------
+
+/**
+ * @brief Finds the first element equal to `value`.
+ *
+ * @param array     Input array.
+ * @param size      Number of elements.
+ * @param value     Value to look for.
+ * @param out_index Pointer set to the index found, or to `size` if there is none.
+ *
+ * @retval ARRAY_STATUS_OK          Search completed (check `*out_index`).
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_find(const int32_t* array, size_t size, int32_t value,
+                                        size_t* out_index)
+{
+    array_status_t status = search_check(array, size, out_index);
+    if (status == ARRAY_STATUS_OK)
+    {
+        *out_index = search_forward(array, size, FILTER_PRED_EQ, value);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Finds the last element equal to `value`.
+ *
+ * @see array_find()
+ */
+static inline array_status_t array_find_last(const int32_t* array, size_t size, int32_t value,
+                                             size_t* out_index)
+{
+    array_status_t status = search_check(array, size, out_index);
+    if (status == ARRAY_STATUS_OK)
+    {
+        *out_index = search_backward(array, size, FILTER_PRED_EQ, value);
+    }
+
+    return status;
+}
+
+// -----------------------------
+//   Threshold
+// -----------------------------
+
+/**
+ * @brief Finds the first element strictly greater than `threshold`.
+ *
+ * @param array     Input array.
+ * @param size      Number of elements.
+ * @param threshold Threshold.
+ * @param out_index Pointer set to the index found, or to `size` if there is none.
+ *
+ * @retval ARRAY_STATUS_OK          Search completed (check `*out_index`).
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_find_first_gt(const int32_t* array, size_t size,
+                                                 int32_t threshold, size_t* out_index)
+{
+    array_status_t status = search_check(array, size, out_index);
+    if (status == ARRAY_STATUS_OK)
+    {
+        *out_index = search_forward(array, size, FILTER_PRED_GT, threshold);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Finds the first element strictly less than `threshold`.
+ *
+ * @see array_find_first_gt()
+ */
+static inline array_status_t array_find_first_lt(const int32_t* array, size_t size,
+                                                 int32_t threshold, size_t* out_index)
+{
+    array_status_t status = search_check(array, size, out_index);
+    if (status == ARRAY_STATUS_OK)
+    {
+        *out_index = search_forward(array, size, FILTER_PRED_LT, threshold);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Finds the first threshold crossing.
+ *
+ * The reported index is the first sample on the new side of the threshold: for a rising edge,
+ * `array[i - 1] < threshold` and `array[i] >= threshold`.
+ *
+ * @param array     Input array.
+ * @param size      Number of elements.
+ * @param threshold Threshold.
+ * @param edge      Kind of crossing to look for.
+ * @param out_index Pointer set to the index found, or to `size` if there is none.
+ *
+ * @retval ARRAY_STATUS_OK                  Search completed (check `*out_index`).
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT Unknown edge kind.
+ */
+static inline array_status_t array_find_crossing(const int32_t* array, size_t size,
+                                                 int32_t threshold, search_edge_t edge,
+                                                 size_t* out_index)
+{
+    array_status_t status = search_check(array, size, out_index);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    switch (edge)
+    {
+    case SEARCH_EDGE_RISING:
+        *out_index = search_crossing(array, size, threshold, SEARCH_EDGE_RISING);
+        break;
+    case SEARCH_EDGE_FALLING:
+        *out_index = search_crossing(array, size, threshold, SEARCH_EDGE_FALLING);
+        break;
+    case SEARCH_EDGE_ANY:
+        *out_index = search_crossing(array, size, threshold, SEARCH_EDGE_ANY);
+        break;
+    default:
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+#endif // ARRAY_SEARCH_H
@@ -15,22 +15,9 @@
 //   Includes
 // -----------------------------
 
+#include "array_status.h"
 #include <stddef.h>
 
-// -----------------------------
-//   Type Definitions
-// -----------------------------
-
-/**
- * @brief Status codes returned by array utility functions.
- */
-typedef enum
-{
-    ARRAY_STATUS_OK = 0,     /**< Operation completed successfully */
-    ARRAY_STATUS_ERROR_NULL, /**< One or more NULL pointers passed */
-    ARRAY_STATUS_ERROR_EMPTY /**< The array size is zero */
-} array_status_t;
-
 // -----------------------------
 //   Function Declarations (Inline Implementations)
 // -----------------------------
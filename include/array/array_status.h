@@ -0,0 +1,25 @@
+/**
+ * @file array_status.h
+ * @brief Status codes shared by all array headers.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_STATUS_H
+#define ARRAY_STATUS_H
+
+/**
+ * @brief Status codes returned by array utility functions.
+ */
+typedef enum
+{
+    ARRAY_STATUS_OK = 0,                 /**< Operation completed successfully */
+    ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, /**< Values were clamped to prevent overflow */
+    ARRAY_STATUS_WARNING_OFFSET_IS_ZERO, /**< Offset was zero; no operation was performed */
+    ARRAY_STATUS_ERROR_NULL,             /**< NULL pointer was passed */
+    ARRAY_STATUS_ERROR_EMPTY,            /**< Array size was zero */
+    ARRAY_STATUS_ERROR_INVALID_INPUT,    /**< Invalid input parameters (e.g., min > max) */
+    ARRAY_STATUS_ERROR_RESOURCE          /**< A system resource (mutex, condition) failed to init */
+} array_status_t;
+
+#endif // ARRAY_STATUS_H
@@ -0,0 +1,415 @@
+/**
+ * @file array_tracked.h
+ * @brief Array handle with per-block cached min / max / sum and dirty-block tracking.
+ *
+ * The array is split into blocks of `TRACKED_BLOCK` elements, each with a cached summary. Writes
+ * go through the handle and only mark the touched blocks dirty (one bit each, in an
+ * `array_bitset_t`). A statistics query first re-summarizes the dirty blocks, then answers
+ * from the cached totals:
+ *
+ * - the sum is patched with the difference of each refreshed block, O(blocks touched);
+ * - min / max are patched the same way, unless a refreshed block held the previous extreme and
+ *   no longer does; only then are the block summaries scanned again (O(size / TRACKED_BLOCK)).
+ *
+ * All storage is provided by the caller: the data, `TRACKED_BLOCKS(size)` summaries and
+ * `TRACKED_DIRTY_WORDS(size)` words for the dirty set. Writes that bypass the handle must be
+ * reported with `array_tracked_mark_dirty()`.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_TRACKED_H
+#define ARRAY_TRACKED_H
+
+#include "array_bitset.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------
+//   Configuration
+// -----------------------------
+
+/** Elements per summarized block. */
+#define TRACKED_BLOCK 256U
+
+/** Number of block summaries needed for `size` elements. */
+#define TRACKED_BLOCKS(size) (((size) + TRACKED_BLOCK - 1U) / TRACKED_BLOCK)
+
+/** Number of dirty-set words needed for `size` elements. */
+#define TRACKED_DIRTY_WORDS(size) BITSET_WORDS(TRACKED_BLOCKS(size))
+
+// -----------------------------
+//   Type Definitions
+// -----------------------------
+
+/**
+ * @brief Summary of one block (or of the whole array).
+ */
+typedef struct
+{
+    int32_t min; /**< Minimum element */
+    int32_t max; /**< Maximum element */
+    int64_t sum; /**< Sum of the elements */
+} tracked_summary_t;
+
+/**
+ * @brief Tracked array handle.
+ */
+typedef struct
+{
+    int32_t* data;             /**< Elements */
+    size_t size;               /**< Number of elements */
+    tracked_summary_t* blocks; /**< Per-block summaries (valid for clean blocks) */
+    size_t block_count;        /**< TRACKED_BLOCKS(size) */
+    array_bitset_t dirty;      /**< One bit per block whose summary is stale */
+    tracked_summary_t total;   /**< Summary of the whole array (valid when nothing is dirty) */
+} array_tracked_t;
+
+// -----------------------------
+//   Helpers
+// -----------------------------
+
+/**
+ * @brief Computes the summary of block `k` from the data.
+ */
+static inline tracked_summary_t tracked_summarize(const array_tracked_t* tracked, size_t k)
+{
+    size_t start = k * TRACKED_BLOCK;
+    size_t end = (tracked->size - start < TRACKED_BLOCK) ? tracked->size : start + TRACKED_BLOCK;
+    tracked_summary_t s = {INT32_MAX, INT32_MIN, 0};
+
+    for (size_t i = start; i < end; ++i)
+    {
+        int32_t value = tracked->data[i];
+        s.min = (value < s.min) ? value : s.min;
+        s.max = (value > s.max) ? value : s.max;
+        s.sum += value;
+    }
+
+    return s;
+}
+
+/**
+ * @brief Recomputes the whole-array min / max from the block summaries.
+ */
+static inline void tracked_rescan(array_tracked_t* tracked)
+{
+    tracked->total.min = INT32_MAX;
+    tracked->total.max = INT32_MIN;
+
+    for (size_t k = 0U; k < tracked->block_count; ++k)
+    {
+        const tracked_summary_t* s = &tracked->blocks[k];
+        tracked->total.min = (s->min < tracked->total.min) ? s->min : tracked->total.min;
+        tracked->total.max = (s->max > tracked->total.max) ? s->max : tracked->total.max;
+    }
+}
+
+/**
+ * @brief Re-summarizes every dirty block and patches the totals.
+ */
+static inline void tracked_refresh(array_tracked_t* tracked)
+{
+    bool rescan = false;
+    size_t k = 0U;
+
+    array_bitset_find_first(&tracked->dirty, &k);
+
+    while (k < tracked->block_count)
+    {
+        tracked_summary_t old = tracked->blocks[k];
+        tracked_summary_t s = tracked_summarize(tracked, k);
+
+        tracked->blocks[k] = s;
+        tracked->total.sum += s.sum - old.sum;
+
+        // A block can lower the minimum on its own, but if it held the minimum and its own
+        // minimum went up, another block may now hold it
+        if (s.min <= tracked->total.min)
+        {
+            tracked->total.min = s.min;
+        }
+        else if (old.min == tracked->total.min)
+        {
+            rescan = true;
+        }
+
+        if (s.max >= tracked->total.max)
+        {
+            tracked->total.max = s.max;
+        }
+        else if (old.max == tracked->total.max)
+        {
+            rescan = true;
+        }
+
+        array_bitset_clear_range(&tracked->dirty, k, 1U);
+        array_bitset_find_next(&tracked->dirty, k + 1U, &k);
+    }
+
+    if (rescan)
+    {
+        tracked_rescan(tracked);
+    }
+}
+
+/**
+ * @brief Validates a handle and a [start, start + count) element range.
+ */
+static inline array_status_t tracked_check_range(const array_tracked_t* tracked, size_t start,
+                                                 size_t count)
+{
+    if (tracked == NULL || tracked->data == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (count == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if (start > tracked->size || count > tracked->size - start)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Marks the blocks covering [start, start + count) dirty (range already validated).
+ */
+static inline void tracked_mark(array_tracked_t* tracked, size_t start, size_t count)
+{
+    size_t first = start / TRACKED_BLOCK;
+    size_t last = (start + count - 1U) / TRACKED_BLOCK;
+
+    array_bitset_set_range(&tracked->dirty, first, last - first + 1U);
+}
+
+// -----------------------------
+//   Setup
+// -----------------------------
+
+/**
+ * @brief Attaches storage to a tracked array and summarizes all blocks.
+ *
+ * @param tracked     Pointer to the handle.
+ * @param data        Elements (kept in place; write through the handle afterwards).
+ * @param size        Number of elements.
+ * @param blocks      Storage for `TRACKED_BLOCKS(size)` summaries.
+ * @param dirty_words Storage for `TRACKED_DIRTY_WORDS(size)` words.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_tracked_init(array_tracked_t* tracked, int32_t* data,
+                                                size_t size, tracked_summary_t* blocks,
+                                                uint64_t* dirty_words)
+{
+    if (tracked == NULL || data == NULL || blocks == NULL || dirty_words == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    tracked->data = data;
+    tracked->size = size;
+    tracked->blocks = blocks;
+    tracked->block_count = TRACKED_BLOCKS(size);
+    array_bitset_init(&tracked->dirty, dirty_words, tracked->block_count);
+
+    tracked->total.sum = 0;
+    for (size_t k = 0U; k < tracked->block_count; ++k)
+    {
+        blocks[k] = tracked_summarize(tracked, k);
+        tracked->total.sum += blocks[k].sum;
+    }
+    tracked_rescan(tracked);
+
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Writes
+// -----------------------------
+
+/**
+ * @brief Writes one element and marks its block dirty.
+ *
+ * @param tracked Pointer to an initialized handle.
+ * @param index   Element index.
+ * @param value   New value.
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT Index out of range.
+ */
+static inline array_status_t array_tracked_set(array_tracked_t* tracked, size_t index,
+                                               int32_t value)
+{
+    array_status_t status = tracked_check_range(tracked, index, 1U);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    tracked->data[index] = value;
+    tracked_mark(tracked, index, 1U);
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Copies `count` elements to [start, start + count) and marks their blocks dirty.
+ *
+ * @param tracked Pointer to an initialized handle.
+ * @param start   First element to overwrite.
+ * @param src     New values.
+ * @param count   Number of elements.
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         count was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT Range exceeds the array.
+ */
+static inline array_status_t array_tracked_write(array_tracked_t* tracked, size_t start,
+                                                 const int32_t* src, size_t count)
+{
+    if (src == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    array_status_t status = tracked_check_range(tracked, start, count);
+    if (status != ARRAY_STATUS_OK)
+    {
+        return status;
+    }
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+        tracked->data[start + i] = src[i];
+    }
+
+    tracked_mark(tracked, start, count);
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Reports elements [start, start + count) as modified outside the handle.
+ *
+ * @param tracked Pointer to an initialized handle.
+ * @param start   First modified element.
+ * @param count   Number of modified elements.
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         count was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT Range exceeds the array.
+ */
+static inline array_status_t array_tracked_mark_dirty(array_tracked_t* tracked, size_t start,
+                                                      size_t count)
+{
+    array_status_t status = tracked_check_range(tracked, start, count);
+    if (status == ARRAY_STATUS_OK)
+    {
+        tracked_mark(tracked, start, count);
+    }
+
+    return status;
+}
+
+// -----------------------------
+//   Statistics
+// -----------------------------
+
+/**
+ * @brief Returns min, max and sum, refreshing only the dirty blocks.
+ *
+ * @param tracked Pointer to an initialized handle.
+ * @param out_min Optional pointer for the minimum (may be NULL).
+ * @param out_max Optional pointer for the maximum (may be NULL).
+ * @param out_sum Optional pointer for the sum (may be NULL).
+ *
+ * @retval ARRAY_STATUS_OK         Success.
+ * @retval ARRAY_STATUS_ERROR_NULL NULL handle was passed.
+ */
+static inline array_status_t array_tracked_stats(array_tracked_t* tracked, int32_t* out_min,
+                                                 int32_t* out_max, int64_t* out_sum)
+{
+    if (tracked == NULL || tracked->data == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    tracked_refresh(tracked);
+
+    if (out_min != NULL)
+    {
+        *out_min = tracked->total.min;
+    }
+    if (out_max != NULL)
+    {
+        *out_max = tracked->total.max;
+    }
+    if (out_sum != NULL)
+    {
+        *out_sum = tracked->total.sum;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Minimum element.
+ *
+ * @see array_tracked_stats()
+ */
+static inline array_status_t array_tracked_min(array_tracked_t* tracked, int32_t* out_min)
+{
+    if (out_min == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    return array_tracked_stats(tracked, out_min, NULL, NULL);
+}
+
+/**
+ * @brief Maximum element.
+ *
+ * @see array_tracked_stats()
+ */
+static inline array_status_t array_tracked_max(array_tracked_t* tracked, int32_t* out_max)
+{
+    if (out_max == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    return array_tracked_stats(tracked, NULL, out_max, NULL);
+}
+
+/**
+ * @brief Sum of the elements.
+ *
+ * @see array_tracked_stats()
+ */
+static inline array_status_t array_tracked_sum(array_tracked_t* tracked, int64_t* out_sum)
+{
+    if (out_sum == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    return array_tracked_stats(tracked, NULL, NULL, out_sum);
+}
+
+#endif // ARRAY_TRACKED_H
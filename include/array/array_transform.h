@@ -10,24 +10,12 @@
 #ifndef ARRAY_TRANSFORM_H
 #define ARRAY_TRANSFORM_H
 
+#include "array_status.h"
 #include <limits.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
-/**
- * @brief Status codes returned by array utility functions.
- */
-typedef enum
-{
-    ARRAY_STATUS_OK = 0,                 /**< Operation completed successfully */
-    ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, /**< Values were clamped to prevent overflow */
-    ARRAY_STATUS_WARNING_OFFSET_IS_ZERO, /**< Offset was zero; no operation was performed */
-    ARRAY_STATUS_ERROR_NULL,             /**< NULL pointer was passed */
-    ARRAY_STATUS_ERROR_EMPTY,            /**< Array size was zero */
-    ARRAY_STATUS_ERROR_INVALID_INPUT     /**< Invalid input parameters (e.g., min > max) */
-} array_status_t;
-
 /**
  * @brief Clamp type selector for signed integer ranges.
  */
@@ -59,6 +47,16 @@ typedef enum
     OPERATION_OFFSET
 } operation_check_type_t;
 
+/**
+ * @brief Rounding mode for fixed-point operations (normalize, fractional scale).
+ */
+typedef enum
+{
+    ROUNDING_FLOOR,   /**< Round toward negative infinity (truncate the fraction) */
+    ROUNDING_NEAREST, /**< Round to nearest, ties rounded up */
+    ROUNDING_CEIL     /**< Round toward positive infinity */
+} rounding_mode_t;
+
 /**
  * @brief Checks if an arithmetic operation (scale or offset) would cause overflow.
  *
@@ -161,103 +159,176 @@ static inline bool safe_op_check_uint32(uint32_t value, uint32_t operand, operat
 }
 
 /**
- * @brief Safely offsets each element in the array, with overflow protection.
+ * @brief Resolves the signed clamp type to its [min, max] limits.
  *
- * If any addition causes overflow or underflow, the result is clamped
- * based on the selected integer range (e.g. INT8, INT16, INT32).
+ * @param type    The clamp range (INT8, INT16, INT32).
+ * @param out_min Pointer where the lower limit will be stored.
+ * @param out_max Pointer where the upper limit will be stored.
+ */
+static inline void clamp_limits_int32(clamp_type_int_t type, int32_t* out_min, int32_t* out_max)
+{
+    switch (type)
+    {
+    case CLAMP_INT8:
+        *out_min = INT8_MIN;
+        *out_max = INT8_MAX;
+        break;
+    case CLAMP_INT16:
+        *out_min = INT16_MIN;
+        *out_max = INT16_MAX;
+        break;
+    default:
+        *out_min = INT32_MIN;
+        *out_max = INT32_MAX;
+        break;
+    }
+}
+
+/**
+ * @brief Resolves the unsigned clamp type to its upper limit.
  *
- * @param array  Pointer to the array to offset.
- * @param size   Number of elements in the array.
- * @param offset The value to add to each element.
- * @param type   Range to clamp against.
+ * @param type The clamp range (UINT8, UINT16, UINT32).
  *
- * @retval ARRAY_STATUS_OK                     All additions completed successfully.
- * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
- * @retval ARRAY_STATUS_WARNING_OFFSET_IS_ZERO No operation performed, offset was 0.
- * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
- * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ * @return The maximum value allowed by the clamp type.
  */
-static inline array_status_t array_offset(int32_t* array, size_t size, int32_t offset,
-                                          clamp_type_int_t type)
+static inline uint32_t clamp_limit_uint32(clamp_type_uint_t type)
+{
+    switch (type)
+    {
+    case CLAMP_UINT8:
+        return UINT8_MAX;
+    case CLAMP_UINT16:
+        return UINT16_MAX;
+    default:
+        return UINT32_MAX;
+    }
+}
+
+// -----------------------------
+//   Clamp diagnostics
+// -----------------------------
+
+/**
+ * @brief Number of elements covered by one word of a clamp bitmask.
+ */
+#define CLAMP_MASK_WORD_BITS 64U
+
+/**
+ * @brief Number of `uint64_t` words needed for a clamp bitmask of `size` elements.
+ */
+#define CLAMP_MASK_WORDS(size) (((size) + CLAMP_MASK_WORD_BITS - 1U) / CLAMP_MASK_WORD_BITS)
+
+/**
+ * @brief Resets the optional clamp report outputs when no element is processed.
+ */
+static inline void clamp_report_clear(size_t size, size_t* out_count, uint64_t* out_mask)
+{
+    if (out_count != NULL)
+    {
+        *out_count = 0U;
+    }
+
+    if (out_mask != NULL)
+    {
+        for (size_t w = 0U; w < CLAMP_MASK_WORDS(size); ++w)
+        {
+            out_mask[w] = 0U;
+        }
+    }
+}
+
+/**
+ * @brief Clamps each element to [min, max] and reports which elements were clamped.
+ *
+ * The count and the bitmask are produced in the same pass as the clamp: each block of 64
+ * elements builds one mask word from branch-free compares. Bit `i % 64` of word `i / 64` is set
+ * if element `i` was clamped; unused bits of the last word are zero.
+ *
+ * @param array     Pointer to the array to clamp (modified in-place).
+ * @param size      Number of elements in the array.
+ * @param min       Lower bound.
+ * @param max       Upper bound.
+ * @param out_count Optional pointer where the number of clamped elements is stored (may be NULL).
+ * @param out_mask  Optional bitmask of `CLAMP_MASK_WORDS(size)` words (may be NULL).
+ *
+ * @retval ARRAY_STATUS_OK                  Success (same status as `array_clamp()`).
+ * @retval ARRAY_STATUS_ERROR_NULL          Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT min > max.
+ */
+static inline array_status_t array_clamp_report(int32_t* array, size_t size, int32_t min,
+                                                int32_t max, size_t* out_count,
+                                                uint64_t* out_mask)
 {
     if (array == NULL)
     {
         return ARRAY_STATUS_ERROR_NULL;
     }
-
     if (size == 0U)
     {
         return ARRAY_STATUS_ERROR_EMPTY;
     }
-
-    if (offset == 0)
+    if (min > max)
     {
-        return ARRAY_STATUS_WARNING_OFFSET_IS_ZERO;
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
     }
 
-    bool clamped = false;
+    size_t count = 0U;
 
-    for (size_t i = 0U; i < size; ++i)
+    for (size_t base = 0U; base < size; base += CLAMP_MASK_WORD_BITS)
     {
-        if (!safe_op_check_int32(array[i], offset, OPERATION_OFFSET, type))
-        {
-            clamped = true;
-            int32_t min = INT32_MIN;
-            int32_t max = INT32_MAX;
+        size_t end = (size - base < CLAMP_MASK_WORD_BITS) ? size : base + CLAMP_MASK_WORD_BITS;
+        uint64_t word = 0U;
 
-            switch (type)
-            {
-            case CLAMP_INT8:
-                min = INT8_MIN;
-                max = INT8_MAX;
-                break;
-            case CLAMP_INT16:
-                min = INT16_MIN;
-                max = INT16_MAX;
-                break;
-            default:
-                break;
-            }
+        for (size_t i = base; i < end; ++i)
+        {
+            int32_t value = array[i];
+            uint32_t flag = (uint32_t) ((value < min) | (value > max));
+            value = (value < min) ? min : value;
+            value = (value > max) ? max : value;
+            array[i] = value;
 
-            array[i] = (offset > 0) ? max : min;
+            word |= (uint64_t) flag << (i - base);
+            count += flag;
         }
-        else
+
+        if (out_mask != NULL)
         {
-            array[i] += offset;
+            out_mask[base / CLAMP_MASK_WORD_BITS] = word;
         }
     }
 
-    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+    if (out_count != NULL)
+    {
+        *out_count = count;
+    }
+
+    return ARRAY_STATUS_OK;
 }
 
 /**
- * @brief Safely offsets each element in an unsigned array, with overflow protection.
+ * @brief Offsets each element with overflow protection and reports which elements were clamped.
  *
- * If any addition exceeds the maximum allowed value for the selected type (e.g. UINT8, UINT16),
- * the value is clamped to the maximum.
+ * Same semantics as `array_offset()`; the clamp count and bitmask (see `array_clamp_report()`)
+ * are produced by the same pass. A positive offset saturates at the upper limit of the clamp
+ * type, a negative offset at the lower limit.
  *
- * @param array  Pointer to the unsigned array to offset.
- * @param size   Number of elements in the array.
- * @param offset The unsigned value to add to each element.
- * @param type   The clamp limit type (UINT8, UINT16, UINT32).
+ * @param array     Pointer to the array to offset (modified in-place).
+ * @param size      Number of elements in the array.
+ * @param offset    The value to add to each element.
+ * @param type      Range to clamp against.
+ * @param out_count Optional pointer where the number of clamped elements is stored (may be NULL).
+ * @param out_mask  Optional bitmask of `CLAMP_MASK_WORDS(size)` words (may be NULL).
  *
- * @retval ARRAY_STATUS_OK                     All additions were successful.
- * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped to prevent overflow.
- * @retval ARRAY_STATUS_WARNING_OFFSET_IS_ZERO Offset was zero, no operation performed.
- * @retval ARRAY_STATUS_ERROR_NULL             Array pointer is NULL.
- * @retval ARRAY_STATUS_ERROR_EMPTY            Array size is zero.
+ * @retval ARRAY_STATUS_OK                     All additions completed successfully.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_WARNING_OFFSET_IS_ZERO No operation performed, offset was 0.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
  */
-// NOTE:
-// This function does not use `safe_op_check_uint32()` because
-// in unsigned arithmetic, overflow detection is simpler and faster.
-// Specifically, checking `a + b > MAX` is sufficient since unsigned integers
-// wrap around on overflow and cannot be negative.
-//
-// If a unified approach is needed (e.g., via function pointer abstraction),
-// this can be refactored later with `safe_op_check_uint32()`
-// at the cost of a slight performance tradeoff.
-static inline array_status_t array_offset_uint(uint32_t* array, size_t size, uint32_t offset,
-                                               clamp_type_uint_t type)
+static inline array_status_t array_offset_report(int32_t* array, size_t size, int32_t offset,
+                                                 clamp_type_int_t type, size_t* out_count,
+                                                 uint64_t* out_mask)
 {
     if (array == NULL)
     {
@@ -269,77 +340,143 @@ static inline array_status_t array_offset_uint(uint32_t* array, size_t size, uin
         return ARRAY_STATUS_ERROR_EMPTY;
     }
 
-    if (offset == 0U)
+    if (offset == 0)
     {
+        clamp_report_clear(size, out_count, out_mask);
         return ARRAY_STATUS_WARNING_OFFSET_IS_ZERO;
     }
 
-    bool clamped = false;
-    uint32_t max = UINT32_MAX;
+    int32_t min = INT32_MIN;
+    int32_t max = INT32_MAX;
+    clamp_limits_int32(type, &min, &max);
 
-    switch (type)
-    {
-    case CLAMP_UINT8:
-        max = UINT8_MAX;
-        break;
-    case CLAMP_UINT16:
-        max = UINT16_MAX;
-        break;
-    default:
-        break;
-    }
+    // Only the limit in the direction of the offset can be crossed
+    const int64_t upper = (offset > 0) ? max : INT64_MAX;
+    const int64_t lower = (offset < 0) ? min : INT64_MIN;
+    size_t count = 0U;
 
-    for (size_t i = 0U; i < size; ++i)
+    for (size_t base = 0U; base < size; base += CLAMP_MASK_WORD_BITS)
     {
-        if (array[i] > (max - offset))
+        size_t end = (size - base < CLAMP_MASK_WORD_BITS) ? size : base + CLAMP_MASK_WORD_BITS;
+        uint64_t word = 0U;
+
+        for (size_t i = base; i < end; ++i)
         {
-            array[i] = max;
-            clamped = true;
+            int64_t result = (int64_t) array[i] + offset;
+            uint32_t flag = (uint32_t) ((result > upper) | (result < lower));
+            result = (result > upper) ? upper : result;
+            result = (result < lower) ? lower : result;
+            array[i] = (int32_t) result;
+
+            word |= (uint64_t) flag << (i - base);
+            count += flag;
         }
-        else
+
+        if (out_mask != NULL)
         {
-            array[i] += offset;
+            out_mask[base / CLAMP_MASK_WORD_BITS] = word;
         }
     }
 
-    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+    if (out_count != NULL)
+    {
+        *out_count = count;
+    }
+
+    return (count != 0U) ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
 }
 
 /**
- * @brief Clamps each element of the array to a specified [min, max] range.
+ * @brief Offsets each element of an unsigned array and reports which elements were clamped.
+ *
+ * Same semantics as `array_offset_uint()`; see `array_clamp_report()` for the output format.
+ *
+ * @param array     Pointer to the unsigned array to offset (modified in-place).
+ * @param size      Number of elements in the array.
+ * @param offset    The unsigned value to add to each element.
+ * @param type      The clamp limit type (UINT8, UINT16, UINT32).
+ * @param out_count Optional pointer where the number of clamped elements is stored (may be NULL).
+ * @param out_mask  Optional bitmask of `CLAMP_MASK_WORDS(size)` words (may be NULL).
+ *
+ * @retval ARRAY_STATUS_OK                     All additions were successful.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped to prevent overflow.
+ * @retval ARRAY_STATUS_WARNING_OFFSET_IS_ZERO Offset was zero, no operation performed.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer is NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size is zero.
  */
-static inline array_status_t array_clamp(int32_t* array, size_t size, int32_t min, int32_t max)
+static inline array_status_t array_offset_uint_report(uint32_t* array, size_t size,
+                                                      uint32_t offset, clamp_type_uint_t type,
+                                                      size_t* out_count, uint64_t* out_mask)
 {
     if (array == NULL)
     {
         return ARRAY_STATUS_ERROR_NULL;
     }
+
     if (size == 0U)
     {
         return ARRAY_STATUS_ERROR_EMPTY;
     }
-    if (min > max)
+
+    if (offset == 0U)
     {
-        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+        clamp_report_clear(size, out_count, out_mask);
+        return ARRAY_STATUS_WARNING_OFFSET_IS_ZERO;
     }
 
-    for (size_t i = 0U; i < size; ++i)
+    const uint64_t max = clamp_limit_uint32(type);
+    size_t count = 0U;
+
+    for (size_t base = 0U; base < size; base += CLAMP_MASK_WORD_BITS)
     {
-        if (array[i] < min)
+        size_t end = (size - base < CLAMP_MASK_WORD_BITS) ? size : base + CLAMP_MASK_WORD_BITS;
+        uint64_t word = 0U;
+
+        for (size_t i = base; i < end; ++i)
         {
-            array[i] = min;
+            uint64_t result = (uint64_t) array[i] + offset;
+            uint32_t flag = (uint32_t) (result > max);
+            array[i] = (uint32_t) ((result > max) ? max : result);
+
+            word |= (uint64_t) flag << (i - base);
+            count += flag;
         }
-        else if (array[i] > max)
+
+        if (out_mask != NULL)
         {
-            array[i] = max;
+            out_mask[base / CLAMP_MASK_WORD_BITS] = word;
         }
     }
 
-    return ARRAY_STATUS_OK;
+    if (out_count != NULL)
+    {
+        *out_count = count;
+    }
+
+    return (count != 0U) ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
 }
 
-static inline array_status_t array_scale(int32_t* array, size_t size, int32_t factor,
-                                         clamp_type_int_t type)
+/**
+ * @brief Scales each element with overflow protection and reports which elements were clamped.
+ *
+ * Same semantics as `array_scale()`; see `array_clamp_report()` for the output format. Results
+ * are saturated towards the sign of the exact product.
+ *
+ * @param array     Pointer to the array to scale (modified in-place).
+ * @param size      Number of elements in the array.
+ * @param factor    Multiplication factor.
+ * @param type      Range to clamp against.
+ * @param out_count Optional pointer where the number of clamped elements is stored (may be NULL).
+ * @param out_mask  Optional bitmask of `CLAMP_MASK_WORDS(size)` words (may be NULL).
+ *
+ * @retval ARRAY_STATUS_OK                     All elements scaled successfully.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_scale_report(int32_t* array, size_t size, int32_t factor,
+                                                clamp_type_int_t type, size_t* out_count,
+                                                uint64_t* out_mask)
 {
     if (array == NULL)
     {
@@ -351,57 +488,63 @@ static inline array_status_t array_scale(int32_t* array, size_t size, int32_t fa
         return ARRAY_STATUS_ERROR_EMPTY;
     }
 
-    bool clamped = false;
-
     int32_t min = INT32_MIN;
     int32_t max = INT32_MAX;
+    clamp_limits_int32(type, &min, &max);
 
-    if (type == CLAMP_INT8)
-    {
-        min = INT8_MIN;
-        max = INT8_MAX;
-    }
+    size_t count = 0U;
 
-    if (type == CLAMP_INT16)
+    for (size_t base = 0U; base < size; base += CLAMP_MASK_WORD_BITS)
     {
-        min = INT16_MIN;
-        max = INT16_MAX;
-    }
+        size_t end = (size - base < CLAMP_MASK_WORD_BITS) ? size : base + CLAMP_MASK_WORD_BITS;
+        uint64_t word = 0U;
 
-    for (size_t i = 0U; i < size; ++i)
-    {
-        if (!safe_op_check_int32(array[i], factor, OPERATION_SCALE, type))
+        for (size_t i = base; i < end; ++i)
         {
-            array[i] = (factor > 0) ? max : min;
-            clamped = true;
+            int64_t result = (int64_t) array[i] * factor;
+            uint32_t flag = (uint32_t) ((result < min) | (result > max));
+            result = (result < min) ? min : result;
+            result = (result > max) ? max : result;
+            array[i] = (int32_t) result;
+
+            word |= (uint64_t) flag << (i - base);
+            count += flag;
         }
-        else
+
+        if (out_mask != NULL)
         {
-            array[i] *= factor;
+            out_mask[base / CLAMP_MASK_WORD_BITS] = word;
         }
     }
 
-    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+    if (out_count != NULL)
+    {
+        *out_count = count;
+    }
+
+    return (count != 0U) ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
 }
 
 /**
- * @brief Safely scales each element of an unsigned array by a given factor, with overflow
- * protection.
+ * @brief Scales each element of an unsigned array and reports which elements were clamped.
  *
- * If the result exceeds the type's maximum (e.g. UINT8_MAX), the value is clamped to the max.
+ * Same semantics as `array_scale_uint()`; see `array_clamp_report()` for the output format.
  *
- * @param array   Pointer to the unsigned input/output array (modified in-place).
- * @param size    Number of elements in the array.
- * @param factor  Multiplication factor.
- * @param type    Unsigned integer range to clamp against.
+ * @param array     Pointer to the unsigned array to scale (modified in-place).
+ * @param size      Number of elements in the array.
+ * @param factor    Multiplication factor.
+ * @param type      Unsigned integer range to clamp against.
+ * @param out_count Optional pointer where the number of clamped elements is stored (may be NULL).
+ * @param out_mask  Optional bitmask of `CLAMP_MASK_WORDS(size)` words (may be NULL).
  *
  * @retval ARRAY_STATUS_OK                     All elements scaled successfully.
  * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
  * @retval ARRAY_STATUS_ERROR_NULL             Null pointer input.
  * @retval ARRAY_STATUS_ERROR_EMPTY            Zero-length array.
  */
-static inline array_status_t array_scale_uint(uint32_t* array, size_t size, uint32_t factor,
-                                              clamp_type_uint_t type)
+static inline array_status_t array_scale_uint_report(uint32_t* array, size_t size,
+                                                     uint32_t factor, clamp_type_uint_t type,
+                                                     size_t* out_count, uint64_t* out_mask)
 {
     if (array == NULL)
     {
@@ -413,34 +556,1392 @@ static inline array_status_t array_scale_uint(uint32_t* array, size_t size, uint
         return ARRAY_STATUS_ERROR_EMPTY;
     }
 
-    bool clamped = false;
+    const uint64_t max = clamp_limit_uint32(type);
+    size_t count = 0U;
 
-    // Select clamping max based on desired type
-    uint32_t max = UINT32_MAX;
-    if (type == CLAMP_UINT8)
+    for (size_t base = 0U; base < size; base += CLAMP_MASK_WORD_BITS)
     {
-        max = UINT8_MAX;
-    }
-    else if (type == CLAMP_UINT16)
-    {
-        max = UINT16_MAX;
-    }
+        size_t end = (size - base < CLAMP_MASK_WORD_BITS) ? size : base + CLAMP_MASK_WORD_BITS;
+        uint64_t word = 0U;
 
-    // Scale each element with overflow detection
-    for (size_t i = 0U; i < size; ++i)
-    {
-        if ((factor != 0U) && (array[i] > (max / factor)))
+        for (size_t i = base; i < end; ++i)
         {
-            array[i] = max; // Clamp on overflow
-            clamped = true;
+            uint64_t result = (uint64_t) array[i] * factor;
+            uint32_t flag = (uint32_t) (result > max);
+            array[i] = (uint32_t) ((result > max) ? max : result);
+
+            word |= (uint64_t) flag << (i - base);
+            count += flag;
         }
-        else
+
+        if (out_mask != NULL)
         {
-            array[i] *= factor;
+            out_mask[base / CLAMP_MASK_WORD_BITS] = word;
         }
     }
 
-    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+    if (out_count != NULL)
+    {
+        *out_count = count;
+    }
+
+    return (count != 0U) ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Safely offsets each element in the array, with overflow protection.
+ *
+ * If any addition causes overflow or underflow, the result is clamped
+ * based on the selected integer range (e.g. INT8, INT16, INT32).
+ *
+ * @param array  Pointer to the array to offset.
+ * @param size   Number of elements in the array.
+ * @param offset The value to add to each element.
+ * @param type   Range to clamp against.
+ *
+ * @retval ARRAY_STATUS_OK                     All additions completed successfully.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_WARNING_OFFSET_IS_ZERO No operation performed, offset was 0.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_offset(int32_t* array, size_t size, int32_t offset,
+                                          clamp_type_int_t type)
+{
+    return array_offset_report(array, size, offset, type, NULL, NULL);
+}
+
+/**
+ * @brief Safely offsets each element in an unsigned array, with overflow protection.
+ *
+ * If any addition exceeds the maximum allowed value for the selected type (e.g. UINT8, UINT16),
+ * the value is clamped to the maximum.
+ *
+ * @param array  Pointer to the unsigned array to offset.
+ * @param size   Number of elements in the array.
+ * @param offset The unsigned value to add to each element.
+ * @param type   The clamp limit type (UINT8, UINT16, UINT32).
+ *
+ * @retval ARRAY_STATUS_OK                     All additions were successful.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped to prevent overflow.
+ * @retval ARRAY_STATUS_WARNING_OFFSET_IS_ZERO Offset was zero, no operation performed.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer is NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size is zero.
+ */
+static inline array_status_t array_offset_uint(uint32_t* array, size_t size, uint32_t offset,
+                                               clamp_type_uint_t type)
+{
+    return array_offset_uint_report(array, size, offset, type, NULL, NULL);
+}
+
+/**
+ * @brief Clamps each element of the array to a specified [min, max] range.
+ */
+static inline array_status_t array_clamp(int32_t* array, size_t size, int32_t min, int32_t max)
+{
+    return array_clamp_report(array, size, min, max, NULL, NULL);
+}
+
+static inline array_status_t array_scale(int32_t* array, size_t size, int32_t factor,
+                                         clamp_type_int_t type)
+{
+    return array_scale_report(array, size, factor, type, NULL, NULL);
+}
+
+/**
+ * @brief Safely scales each element of an unsigned array by a given factor, with overflow
+ * protection.
+ *
+ * If the result exceeds the type's maximum (e.g. UINT8_MAX), the value is clamped to the max.
+ *
+ * @param array   Pointer to the unsigned input/output array (modified in-place).
+ * @param size    Number of elements in the array.
+ * @param factor  Multiplication factor.
+ * @param type    Unsigned integer range to clamp against.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements scaled successfully.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             Null pointer input.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Zero-length array.
+ */
+static inline array_status_t array_scale_uint(uint32_t* array, size_t size, uint32_t factor,
+                                              clamp_type_uint_t type)
+{
+    return array_scale_uint_report(array, size, factor, type, NULL, NULL);
+}
+
+// -----------------------------
+//   Per-element clamp bounds
+// -----------------------------
+
+/**
+ * @brief Clamps each element to its own [lo[i], hi[i]] range and reports the clamped count.
+ *
+ * The bounds are validated in a read-only pass first, so the array is left untouched when any
+ * lo[i] > hi[i]. The clamp loop is branch-free (a min/max per element) and vectorizes.
+ *
+ * @param array     Pointer to the array to clamp (modified in-place).
+ * @param lo        Lower bound for each element.
+ * @param hi        Upper bound for each element.
+ * @param size      Number of elements in the array and in each bound array.
+ * @param out_count Optional pointer where the number of clamped elements is stored (may be NULL).
+ *
+ * @retval ARRAY_STATUS_OK                  Success (same status as `array_clamp()`).
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT lo[i] > hi[i] for some i.
+ */
+static inline array_status_t array_clamp_bounds_report(int32_t* array, const int32_t* lo,
+                                                       const int32_t* hi, size_t size,
+                                                       size_t* out_count)
+{
+    if (array == NULL || lo == NULL || hi == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    uint32_t invalid = 0U;
+    for (size_t i = 0U; i < size; ++i)
+    {
+        invalid |= (uint32_t) (lo[i] > hi[i]);
+    }
+    if (invalid)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    size_t count = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        int32_t value = array[i];
+        count += (size_t) ((value < lo[i]) | (value > hi[i]));
+        value = (value < lo[i]) ? lo[i] : value;
+        value = (value > hi[i]) ? hi[i] : value;
+        array[i] = value;
+    }
+
+    if (out_count != NULL)
+    {
+        *out_count = count;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Clamps each element to its own [lo[i], hi[i]] range (e.g. a safety envelope).
+ *
+ * @see array_clamp_bounds_report()
+ */
+static inline array_status_t array_clamp_bounds(int32_t* array, const int32_t* lo,
+                                                const int32_t* hi, size_t size)
+{
+    return array_clamp_bounds_report(array, lo, hi, size, NULL);
+}
+
+/**
+ * @brief Clamps interleaved multi-channel data with one [lo[c], hi[c]] range per channel.
+ *
+ * Element `i` belongs to channel `i % channels`. The bounds are broadcast frame by frame, so the
+ * inner loop reads `lo` / `hi` contiguously and vectorizes like `array_clamp_bounds()`.
+ *
+ * @param array     Pointer to the interleaved array (modified in-place).
+ * @param size      Number of elements (multiple of `channels`).
+ * @param lo        Lower bound for each channel.
+ * @param hi        Upper bound for each channel.
+ * @param channels  Number of channels.
+ * @param out_count Optional pointer where the number of clamped elements is stored (may be NULL).
+ *
+ * @retval ARRAY_STATUS_OK                  Success.
+ * @retval ARRAY_STATUS_ERROR_NULL          NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         Array size or channel count was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT lo[c] > hi[c], or size is not a multiple of channels.
+ */
+static inline array_status_t array_clamp_bounds_channels(int32_t* array, size_t size,
+                                                         const int32_t* lo, const int32_t* hi,
+                                                         size_t channels, size_t* out_count)
+{
+    if (array == NULL || lo == NULL || hi == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+    if (size == 0U || channels == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+    if (size % channels != 0U)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+    for (size_t c = 0U; c < channels; ++c)
+    {
+        if (lo[c] > hi[c])
+        {
+            return ARRAY_STATUS_ERROR_INVALID_INPUT;
+        }
+    }
+
+    size_t count = 0U;
+
+    for (size_t frame = 0U; frame < size; frame += channels)
+    {
+        int32_t* row = &array[frame];
+
+        for (size_t c = 0U; c < channels; ++c)
+        {
+            int32_t value = row[c];
+            count += (size_t) ((value < lo[c]) | (value > hi[c]));
+            value = (value < lo[c]) ? lo[c] : value;
+            value = (value > hi[c]) ? hi[c] : value;
+            row[c] = value;
+        }
+    }
+
+    if (out_count != NULL)
+    {
+        *out_count = count;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Dry-run overflow prediction
+// -----------------------------
+
+/**
+ * @brief Elements tested per block before the early exit of the `*_would_clamp()` functions.
+ */
+#define CLAMP_PREDICT_CHUNK 256U
+
+/**
+ * @brief Checks whether `array_offset()` would clamp any element, without modifying the array.
+ *
+ * One read-only pass in blocks of `CLAMP_PREDICT_CHUNK` elements: each block is tested
+ * branch-free (vectorizable) and the scan stops at the first block containing an overflow. This
+ * replaces copying the array and running `array_offset()` on the copy.
+ *
+ * @param array     Pointer to the array to check (not modified).
+ * @param size      Number of elements in the array.
+ * @param offset    The value that would be added to each element.
+ * @param type      Range that would be clamped against.
+ * @param out_index Optional pointer for the first offending index, or `size` if none (may be NULL).
+ *
+ * @retval ARRAY_STATUS_OK                     No element would be clamped.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP At least one element would be clamped.
+ * @retval ARRAY_STATUS_WARNING_OFFSET_IS_ZERO Offset was 0, nothing would change.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_offset_would_clamp(const int32_t* array, size_t size,
+                                                      int32_t offset, clamp_type_int_t type,
+                                                      size_t* out_index)
+{
+    if (array == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if (out_index != NULL)
+    {
+        *out_index = size;
+    }
+
+    if (offset == 0)
+    {
+        return ARRAY_STATUS_WARNING_OFFSET_IS_ZERO;
+    }
+
+    int32_t min = INT32_MIN;
+    int32_t max = INT32_MAX;
+    clamp_limits_int32(type, &min, &max);
+
+    // Same rule as array_offset(): only the limit in the direction of the offset can be crossed
+    const int64_t upper = (offset > 0) ? max : INT64_MAX;
+    const int64_t lower = (offset < 0) ? min : INT64_MIN;
+
+    for (size_t base = 0U; base < size; base += CLAMP_PREDICT_CHUNK)
+    {
+        size_t end = (size - base < CLAMP_PREDICT_CHUNK) ? size : base + CLAMP_PREDICT_CHUNK;
+        uint32_t hit = 0U;
+
+        for (size_t i = base; i < end; ++i)
+        {
+            int64_t result = (int64_t) array[i] + offset;
+            hit |= (uint32_t) ((result > upper) | (result < lower));
+        }
+
+        if (hit == 0U)
+        {
+            continue;
+        }
+
+        // Rescan only the offending block to locate the first overflow
+        for (size_t i = base; out_index != NULL && i < end; ++i)
+        {
+            int64_t result = (int64_t) array[i] + offset;
+            if ((result > upper) | (result < lower))
+            {
+                *out_index = i;
+                break;
+            }
+        }
+
+        return ARRAY_STATUS_WARNING_OVERFLOW_CLAMP;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Checks whether `array_offset_uint()` would clamp any element, without modifying the array.
+ *
+ * @see array_offset_would_clamp()
+ *
+ * @param array     Pointer to the array to check (not modified).
+ * @param size      Number of elements in the array.
+ * @param offset    The value that would be added to each element.
+ * @param type      Range that would be clamped against.
+ * @param out_index Optional pointer for the first offending index, or `size` if none (may be NULL).
+ *
+ * @retval ARRAY_STATUS_OK                     No element would be clamped.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP At least one element would be clamped.
+ * @retval ARRAY_STATUS_WARNING_OFFSET_IS_ZERO Offset was 0, nothing would change.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_offset_uint_would_clamp(const uint32_t* array, size_t size,
+                                                           uint32_t offset, clamp_type_uint_t type,
+                                                           size_t* out_index)
+{
+    if (array == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if (out_index != NULL)
+    {
+        *out_index = size;
+    }
+
+    if (offset == 0U)
+    {
+        return ARRAY_STATUS_WARNING_OFFSET_IS_ZERO;
+    }
+
+    const uint64_t max = clamp_limit_uint32(type);
+
+    for (size_t base = 0U; base < size; base += CLAMP_PREDICT_CHUNK)
+    {
+        size_t end = (size - base < CLAMP_PREDICT_CHUNK) ? size : base + CLAMP_PREDICT_CHUNK;
+        uint32_t hit = 0U;
+
+        for (size_t i = base; i < end; ++i)
+        {
+            uint64_t result = (uint64_t) array[i] + offset;
+            hit |= (uint32_t) (result > max);
+        }
+
+        if (hit == 0U)
+        {
+            continue;
+        }
+
+        // Rescan only the offending block to locate the first overflow
+        for (size_t i = base; out_index != NULL && i < end; ++i)
+        {
+            uint64_t result = (uint64_t) array[i] + offset;
+            if (result > max)
+            {
+                *out_index = i;
+                break;
+            }
+        }
+
+        return ARRAY_STATUS_WARNING_OVERFLOW_CLAMP;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Checks whether `array_scale()` would clamp any element, without modifying the array.
+ *
+ * @see array_offset_would_clamp()
+ *
+ * @param array     Pointer to the array to check (not modified).
+ * @param size      Number of elements in the array.
+ * @param factor    Multiplication factor that would be applied.
+ * @param type      Range that would be clamped against.
+ * @param out_index Optional pointer for the first offending index, or `size` if none (may be NULL).
+ *
+ * @retval ARRAY_STATUS_OK                     No element would be clamped.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP At least one element would be clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_scale_would_clamp(const int32_t* array, size_t size,
+                                                     int32_t factor, clamp_type_int_t type,
+                                                     size_t* out_index)
+{
+    if (array == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if (out_index != NULL)
+    {
+        *out_index = size;
+    }
+
+    int32_t min = INT32_MIN;
+    int32_t max = INT32_MAX;
+    clamp_limits_int32(type, &min, &max);
+
+    for (size_t base = 0U; base < size; base += CLAMP_PREDICT_CHUNK)
+    {
+        size_t end = (size - base < CLAMP_PREDICT_CHUNK) ? size : base + CLAMP_PREDICT_CHUNK;
+        uint32_t hit = 0U;
+
+        for (size_t i = base; i < end; ++i)
+        {
+            int64_t result = (int64_t) array[i] * factor;
+            hit |= (uint32_t) ((result < min) | (result > max));
+        }
+
+        if (hit == 0U)
+        {
+            continue;
+        }
+
+        // Rescan only the offending block to locate the first overflow
+        for (size_t i = base; out_index != NULL && i < end; ++i)
+        {
+            int64_t result = (int64_t) array[i] * factor;
+            if ((result < min) | (result > max))
+            {
+                *out_index = i;
+                break;
+            }
+        }
+
+        return ARRAY_STATUS_WARNING_OVERFLOW_CLAMP;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Checks whether `array_scale_uint()` would clamp any element, without modifying the array.
+ *
+ * @see array_offset_would_clamp()
+ *
+ * @param array     Pointer to the array to check (not modified).
+ * @param size      Number of elements in the array.
+ * @param factor    Multiplication factor that would be applied.
+ * @param type      Range that would be clamped against.
+ * @param out_index Optional pointer for the first offending index, or `size` if none (may be NULL).
+ *
+ * @retval ARRAY_STATUS_OK                     No element would be clamped.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP At least one element would be clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_scale_uint_would_clamp(const uint32_t* array, size_t size,
+                                                          uint32_t factor, clamp_type_uint_t type,
+                                                          size_t* out_index)
+{
+    if (array == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if (out_index != NULL)
+    {
+        *out_index = size;
+    }
+
+    const uint64_t max = clamp_limit_uint32(type);
+
+    for (size_t base = 0U; base < size; base += CLAMP_PREDICT_CHUNK)
+    {
+        size_t end = (size - base < CLAMP_PREDICT_CHUNK) ? size : base + CLAMP_PREDICT_CHUNK;
+        uint32_t hit = 0U;
+
+        for (size_t i = base; i < end; ++i)
+        {
+            uint64_t result = (uint64_t) array[i] * factor;
+            hit |= (uint32_t) (result > max);
+        }
+
+        if (hit == 0U)
+        {
+            continue;
+        }
+
+        // Rescan only the offending block to locate the first overflow
+        for (size_t i = base; out_index != NULL && i < end; ++i)
+        {
+            uint64_t result = (uint64_t) array[i] * factor;
+            if (result > max)
+            {
+                *out_index = i;
+                break;
+            }
+        }
+
+        return ARRAY_STATUS_WARNING_OVERFLOW_CLAMP;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Range-aware fast path
+// -----------------------------
+
+/**
+ * @brief Arrays smaller than this skip the min/max pre-pass and use the checked loop directly.
+ */
+#define RANGED_MIN_SIZE 64U
+
+/**
+ * @brief Known value envelope of a signed array (every element is in [min, max]).
+ */
+typedef struct
+{
+    int32_t min; /**< Smallest element */
+    int32_t max; /**< Largest element */
+} array_range_t;
+
+/**
+ * @brief Known value envelope of an unsigned array (every element is in [min, max]).
+ */
+typedef struct
+{
+    uint32_t min; /**< Smallest element */
+    uint32_t max; /**< Largest element */
+} array_range_uint_t;
+
+/**
+ * @brief Computes the min and max of a signed array in one fused, branch-free pass.
+ *
+ * @param array     Pointer to the array.
+ * @param size      Number of elements in the array.
+ * @param out_range Pointer where the envelope will be stored.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_minmax_int32(const int32_t* array, size_t size,
+                                                array_range_t* out_range)
+{
+    if (array == NULL || out_range == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    int32_t min = array[0];
+    int32_t max = array[0];
+
+    for (size_t i = 1U; i < size; ++i)
+    {
+        min = (array[i] < min) ? array[i] : min;
+        max = (array[i] > max) ? array[i] : max;
+    }
+
+    out_range->min = min;
+    out_range->max = max;
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Computes the min and max of an unsigned array in one fused, branch-free pass.
+ *
+ * @param array     Pointer to the array.
+ * @param size      Number of elements in the array.
+ * @param out_range Pointer where the envelope will be stored.
+ *
+ * @retval ARRAY_STATUS_OK          Success.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_minmax_uint32(const uint32_t* array, size_t size,
+                                                 array_range_uint_t* out_range)
+{
+    if (array == NULL || out_range == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    uint32_t min = array[0];
+    uint32_t max = array[0];
+
+    for (size_t i = 1U; i < size; ++i)
+    {
+        min = (array[i] < min) ? array[i] : min;
+        max = (array[i] > max) ? array[i] : max;
+    }
+
+    out_range->min = min;
+    out_range->max = max;
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief `array_offset()` that skips the per-element overflow checks when it can prove them
+ *        unnecessary.
+ *
+ * The envelope [min + offset, max + offset] is compared against the clamp limits once. If no
+ * element can saturate, the array goes through a plain int32 add that vectorizes fully;
+ * otherwise the checked loop of `array_offset()` runs. Results and status are identical to
+ * `array_offset()` in both cases.
+ *
+ * @param array  Pointer to the array to offset (modified in-place).
+ * @param size   Number of elements in the array.
+ * @param offset The value to add to each element.
+ * @param type   Range to clamp against.
+ * @param known  Optional known envelope of the array (must contain every element). If NULL, it is
+ *               computed with `array_minmax_int32()` (skipped below `RANGED_MIN_SIZE` elements).
+ *
+ * @retval ARRAY_STATUS_OK                     All additions completed successfully.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_WARNING_OFFSET_IS_ZERO No operation performed, offset was 0.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_offset_ranged(int32_t* array, size_t size, int32_t offset,
+                                                 clamp_type_int_t type,
+                                                 const array_range_t* known)
+{
+    if (array == NULL || size == 0U || offset == 0 || (known == NULL && size < RANGED_MIN_SIZE))
+    {
+        return array_offset(array, size, offset, type);
+    }
+
+    array_range_t range;
+    if (known != NULL)
+    {
+        range = *known;
+    }
+    else
+    {
+        array_minmax_int32(array, size, &range);
+    }
+
+    int32_t min = INT32_MIN;
+    int32_t max = INT32_MAX;
+    clamp_limits_int32(type, &min, &max);
+
+    // Mirrors array_offset(): only the limit in the direction of the offset is checked
+    bool safe = (offset > 0) ? ((int64_t) range.max + offset <= max)
+                             : ((int64_t) range.min + offset >= min);
+    if (!safe)
+    {
+        return array_offset(array, size, offset, type);
+    }
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        array[i] += offset;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief `array_offset_uint()` with the range-aware fast path of `array_offset_ranged()`.
+ *
+ * @param array  Pointer to the unsigned array to offset (modified in-place).
+ * @param size   Number of elements in the array.
+ * @param offset The unsigned value to add to each element.
+ * @param type   The clamp limit type (UINT8, UINT16, UINT32).
+ * @param known  Optional known envelope of the array (may be NULL).
+ *
+ * @retval ARRAY_STATUS_OK                     All additions were successful.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped to prevent overflow.
+ * @retval ARRAY_STATUS_WARNING_OFFSET_IS_ZERO Offset was zero, no operation performed.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer is NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size is zero.
+ */
+static inline array_status_t array_offset_uint_ranged(uint32_t* array, size_t size,
+                                                      uint32_t offset, clamp_type_uint_t type,
+                                                      const array_range_uint_t* known)
+{
+    if (array == NULL || size == 0U || offset == 0U || (known == NULL && size < RANGED_MIN_SIZE))
+    {
+        return array_offset_uint(array, size, offset, type);
+    }
+
+    array_range_uint_t range;
+    if (known != NULL)
+    {
+        range = *known;
+    }
+    else
+    {
+        array_minmax_uint32(array, size, &range);
+    }
+
+    if ((uint64_t) range.max + offset > clamp_limit_uint32(type))
+    {
+        return array_offset_uint(array, size, offset, type);
+    }
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        array[i] += offset;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief `array_scale()` with the range-aware fast path of `array_offset_ranged()`.
+ *
+ * The product is monotonic in the element for a fixed factor, so the envelope is given by
+ * `min * factor` and `max * factor`.
+ *
+ * @param array  Pointer to the array to scale (modified in-place).
+ * @param size   Number of elements in the array.
+ * @param factor Multiplication factor.
+ * @param type   Range to clamp against.
+ * @param known  Optional known envelope of the array (may be NULL).
+ *
+ * @retval ARRAY_STATUS_OK                     All elements scaled successfully.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_scale_ranged(int32_t* array, size_t size, int32_t factor,
+                                                clamp_type_int_t type, const array_range_t* known)
+{
+    if (array == NULL || size == 0U || (known == NULL && size < RANGED_MIN_SIZE))
+    {
+        return array_scale(array, size, factor, type);
+    }
+
+    array_range_t range;
+    if (known != NULL)
+    {
+        range = *known;
+    }
+    else
+    {
+        array_minmax_int32(array, size, &range);
+    }
+
+    int32_t min = INT32_MIN;
+    int32_t max = INT32_MAX;
+    clamp_limits_int32(type, &min, &max);
+
+    int64_t low = (int64_t) range.min * factor;
+    int64_t high = (int64_t) range.max * factor;
+    if (low > high)
+    {
+        int64_t tmp = low;
+        low = high;
+        high = tmp;
+    }
+
+    if (low < min || high > max)
+    {
+        return array_scale(array, size, factor, type);
+    }
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        array[i] *= factor;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief `array_scale_uint()` with the range-aware fast path of `array_offset_ranged()`.
+ *
+ * @param array  Pointer to the unsigned array to scale (modified in-place).
+ * @param size   Number of elements in the array.
+ * @param factor Multiplication factor.
+ * @param type   Unsigned integer range to clamp against.
+ * @param known  Optional known envelope of the array (may be NULL).
+ *
+ * @retval ARRAY_STATUS_OK                     All elements scaled successfully.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             Null pointer input.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Zero-length array.
+ */
+static inline array_status_t array_scale_uint_ranged(uint32_t* array, size_t size,
+                                                     uint32_t factor, clamp_type_uint_t type,
+                                                     const array_range_uint_t* known)
+{
+    if (array == NULL || size == 0U || (known == NULL && size < RANGED_MIN_SIZE))
+    {
+        return array_scale_uint(array, size, factor, type);
+    }
+
+    array_range_uint_t range;
+    if (known != NULL)
+    {
+        range = *known;
+    }
+    else
+    {
+        array_minmax_uint32(array, size, &range);
+    }
+
+    if ((uint64_t) range.max * factor > clamp_limit_uint32(type))
+    {
+        return array_scale_uint(array, size, factor, type);
+    }
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        array[i] *= factor;
+    }
+
+    return ARRAY_STATUS_OK;
+}
+
+// -----------------------------
+//   Normalize (min-max rescaling)
+// -----------------------------
+
+/**
+ * @brief Fixed-point reciprocal used to rescale offsets from [0, in_span] to [0, out_span].
+ *
+ * Holds `floor(out_span * 2^32 / in_span)` split into its integer and fractional 32-bit halves,
+ * so every multiplication in the per-element kernel fits in 64 bits.
+ */
+typedef struct
+{
+    uint64_t in_span;    /**< Width of the input range (in_max - in_min) */
+    uint64_t out_span;   /**< Width of the output range (out_max - out_min) */
+    uint64_t recip_int;  /**< Integer part of out_span / in_span */
+    uint64_t recip_frac; /**< Fractional part of out_span / in_span, in Q32 */
+    uint64_t round_at;   /**< Remainder threshold at which the quotient is rounded up */
+} normalize_params_t;
+
+/**
+ * @brief Precomputes the fixed-point reciprocal for a range mapping (one division in total).
+ *
+ * @param in_span  Width of the input range (must be > 0).
+ * @param out_span Width of the output range.
+ * @param mode     Rounding mode applied to the rescaled value.
+ */
+static inline normalize_params_t normalize_params_init(uint32_t in_span, uint32_t out_span,
+                                                       rounding_mode_t mode)
+{
+    normalize_params_t params;
+    uint64_t recip = ((uint64_t) out_span << 32) / in_span;
+
+    params.in_span = in_span;
+    params.out_span = out_span;
+    params.recip_int = recip >> 32;
+    params.recip_frac = recip & 0xFFFFFFFFU;
+
+    switch (mode)
+    {
+    case ROUNDING_NEAREST:
+        params.round_at = ((uint64_t) in_span + 1U) / 2U;
+        break;
+    case ROUNDING_CEIL:
+        params.round_at = 1U;
+        break;
+    default:
+        params.round_at = in_span; // remainder is always < in_span: never rounds up
+        break;
+    }
+
+    return params;
+}
+
+/**
+ * @brief Rescales one offset `d` in [0, in_span] to [0, out_span] without dividing.
+ *
+ * The reciprocal estimate is at most one below the exact quotient, so a single branch-free
+ * remainder correction yields the exact floor, and the remainder then selects the rounding.
+ */
+static inline uint32_t normalize_rescale(uint32_t d, const normalize_params_t* params)
+{
+    uint64_t q = (uint64_t) d * params->recip_int + (((uint64_t) d * params->recip_frac) >> 32);
+    uint64_t r = (uint64_t) d * params->out_span - q * params->in_span;
+    uint64_t fix = (uint64_t) (r >= params->in_span);
+
+    q += fix;
+    r -= fix * params->in_span;
+    q += (uint64_t) (r >= params->round_at);
+
+    return (uint32_t) q;
+}
+
+/**
+ * @brief Normalizes a signed array from a known input range to [out_min, out_max] in one pass.
+ *
+ * Each element is mapped linearly so that `in_min -> out_min` and `in_max -> out_max`, using a
+ * precomputed fixed-point reciprocal instead of a per-element division. Elements outside
+ * [in_min, in_max] are clamped to that range first. If `in_min == in_max`, every element is set
+ * to `out_min`.
+ *
+ * Typical targets are [0, 255] for 8-bit output or [INT16_MIN, INT16_MAX] for Q15.
+ *
+ * @param array   Pointer to the array to normalize (modified in-place).
+ * @param size    Number of elements in the array.
+ * @param in_min  Lower bound of the input range (e.g. from `array_min`).
+ * @param in_max  Upper bound of the input range (e.g. from `array_max`).
+ * @param out_min Lower bound of the output range.
+ * @param out_max Upper bound of the output range.
+ * @param mode    Rounding mode for the rescaled values.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements normalized.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more elements were outside [in_min, in_max].
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    in_min > in_max or out_min > out_max.
+ */
+static inline array_status_t array_normalize_range(int32_t* array, size_t size, int32_t in_min,
+                                                   int32_t in_max, int32_t out_min,
+                                                   int32_t out_max, rounding_mode_t mode)
+{
+    if (array == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if (in_min > in_max || out_min > out_max)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    uint32_t in_span = (uint32_t) ((int64_t) in_max - in_min);
+    uint32_t out_span = (uint32_t) ((int64_t) out_max - out_min);
+    uint32_t clamped = 0U;
+
+    if (in_span == 0U)
+    {
+        for (size_t i = 0U; i < size; ++i)
+        {
+            clamped |= (uint32_t) (array[i] != in_min);
+            array[i] = out_min;
+        }
+        return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+    }
+
+    normalize_params_t params = normalize_params_init(in_span, out_span, mode);
+
+    // Branch-free body: clamp, rescale and shift back to the output range
+    for (size_t i = 0U; i < size; ++i)
+    {
+        int32_t value = array[i];
+        clamped |= (uint32_t) ((value < in_min) | (value > in_max));
+        value = (value < in_min) ? in_min : value;
+        value = (value > in_max) ? in_max : value;
+
+        uint32_t d = (uint32_t) ((int64_t) value - in_min);
+        array[i] = (int32_t) ((int64_t) out_min + normalize_rescale(d, &params));
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Normalizes an unsigned array from a known input range to [out_min, out_max] in one pass.
+ *
+ * Unsigned counterpart of `array_normalize_range()`; same mapping, clamping and rounding rules.
+ *
+ * @param array   Pointer to the unsigned array to normalize (modified in-place).
+ * @param size    Number of elements in the array.
+ * @param in_min  Lower bound of the input range.
+ * @param in_max  Upper bound of the input range.
+ * @param out_min Lower bound of the output range.
+ * @param out_max Upper bound of the output range.
+ * @param mode    Rounding mode for the rescaled values.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements normalized.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more elements were outside [in_min, in_max].
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    in_min > in_max or out_min > out_max.
+ */
+static inline array_status_t array_normalize_range_uint(uint32_t* array, size_t size,
+                                                        uint32_t in_min, uint32_t in_max,
+                                                        uint32_t out_min, uint32_t out_max,
+                                                        rounding_mode_t mode)
+{
+    if (array == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if (in_min > in_max || out_min > out_max)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    uint32_t in_span = in_max - in_min;
+    uint32_t clamped = 0U;
+
+    if (in_span == 0U)
+    {
+        for (size_t i = 0U; i < size; ++i)
+        {
+            clamped |= (uint32_t) (array[i] != in_min);
+            array[i] = out_min;
+        }
+        return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+    }
+
+    normalize_params_t params = normalize_params_init(in_span, out_max - out_min, mode);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        uint32_t value = array[i];
+        clamped |= (uint32_t) ((value < in_min) | (value > in_max));
+        value = (value < in_min) ? in_min : value;
+        value = (value > in_max) ? in_max : value;
+
+        array[i] = out_min + normalize_rescale(value - in_min, &params);
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Normalizes a signed array to [out_min, out_max] using its own min and max.
+ *
+ * Performs one read-only pass to find the input range and then the fused rescaling pass of
+ * `array_normalize_range()`. If the min/max are already known, call that function directly.
+ *
+ * @param array   Pointer to the array to normalize (modified in-place).
+ * @param size    Number of elements in the array.
+ * @param out_min Lower bound of the output range.
+ * @param out_max Upper bound of the output range.
+ * @param mode    Rounding mode for the rescaled values.
+ *
+ * @retval ARRAY_STATUS_OK                  All elements normalized.
+ * @retval ARRAY_STATUS_ERROR_NULL          Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT out_min > out_max.
+ */
+static inline array_status_t array_normalize(int32_t* array, size_t size, int32_t out_min,
+                                             int32_t out_max, rounding_mode_t mode)
+{
+    if (array == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    int32_t min = array[0];
+    int32_t max = array[0];
+    for (size_t i = 1U; i < size; ++i)
+    {
+        min = (array[i] < min) ? array[i] : min;
+        max = (array[i] > max) ? array[i] : max;
+    }
+
+    return array_normalize_range(array, size, min, max, out_min, out_max, mode);
+}
+
+/**
+ * @brief Normalizes an unsigned array to [out_min, out_max] using its own min and max.
+ *
+ * @param array   Pointer to the unsigned array to normalize (modified in-place).
+ * @param size    Number of elements in the array.
+ * @param out_min Lower bound of the output range.
+ * @param out_max Upper bound of the output range.
+ * @param mode    Rounding mode for the rescaled values.
+ *
+ * @retval ARRAY_STATUS_OK                  All elements normalized.
+ * @retval ARRAY_STATUS_ERROR_NULL          Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY         Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT out_min > out_max.
+ */
+static inline array_status_t array_normalize_uint(uint32_t* array, size_t size, uint32_t out_min,
+                                                  uint32_t out_max, rounding_mode_t mode)
+{
+    if (array == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    uint32_t min = array[0];
+    uint32_t max = array[0];
+    for (size_t i = 1U; i < size; ++i)
+    {
+        min = (array[i] < min) ? array[i] : min;
+        max = (array[i] > max) ? array[i] : max;
+    }
+
+    return array_normalize_range_uint(array, size, min, max, out_min, out_max, mode);
+}
+
+// -----------------------------
+//   Fixed-point (fractional) scale
+// -----------------------------
+
+/**
+ * @brief Rounding bias added before an arithmetic right shift by `frac_bits`.
+ */
+static inline int64_t fixed_round_bias(unsigned frac_bits, rounding_mode_t mode)
+{
+    switch (mode)
+    {
+    case ROUNDING_NEAREST:
+        return (int64_t) 1 << (frac_bits - 1U);
+    case ROUNDING_CEIL:
+        return ((int64_t) 1 << frac_bits) - 1;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Scales each element by a fixed-point factor with `frac_bits` fractional bits.
+ *
+ * Computes `round(array[i] * factor / 2^frac_bits)` with a 64-bit product and a single shift,
+ * so fractional factors (e.g. 0.75 or 1.3) need no floating point. Results outside the selected
+ * range are saturated to its limits.
+ *
+ * @note Relies on arithmetic right shift of negative `int64_t` values, as provided by all
+ *       supported compilers.
+ *
+ * @param array     Pointer to the array to scale (modified in-place).
+ * @param size      Number of elements in the array.
+ * @param factor    Scale factor in fixed-point format (value = factor / 2^frac_bits).
+ * @param frac_bits Number of fractional bits of `factor` (1..31).
+ * @param mode      Rounding mode applied to the discarded fraction.
+ * @param type      Range to clamp against.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements scaled successfully.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    frac_bits outside 1..31.
+ */
+static inline array_status_t array_scale_fixed(int32_t* array, size_t size, int32_t factor,
+                                               unsigned frac_bits, rounding_mode_t mode,
+                                               clamp_type_int_t type)
+{
+    if (array == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if (frac_bits == 0U || frac_bits > 31U)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    int32_t min = INT32_MIN;
+    int32_t max = INT32_MAX;
+    clamp_limits_int32(type, &min, &max);
+
+    const int64_t bias = fixed_round_bias(frac_bits, mode);
+    uint32_t clamped = 0U;
+
+    // Branch-free body: widening multiply, round, shift, saturate
+    for (size_t i = 0U; i < size; ++i)
+    {
+        int64_t result = ((int64_t) array[i] * factor + bias) >> frac_bits;
+        clamped |= (uint32_t) ((result < min) | (result > max));
+        result = (result < min) ? min : result;
+        result = (result > max) ? max : result;
+        array[i] = (int32_t) result;
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Scales each element of an unsigned array by a fixed-point factor.
+ *
+ * Unsigned counterpart of `array_scale_fixed()`: computes
+ * `round(array[i] * factor / 2^frac_bits)` and saturates to the selected maximum.
+ *
+ * @param array     Pointer to the unsigned array to scale (modified in-place).
+ * @param size      Number of elements in the array.
+ * @param factor    Unsigned scale factor in fixed-point format (value = factor / 2^frac_bits).
+ * @param frac_bits Number of fractional bits of `factor` (1..31).
+ * @param mode      Rounding mode applied to the discarded fraction.
+ * @param type      Unsigned integer range to clamp against.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements scaled successfully.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    frac_bits outside 1..31.
+ */
+static inline array_status_t array_scale_fixed_uint(uint32_t* array, size_t size, uint32_t factor,
+                                                    unsigned frac_bits, rounding_mode_t mode,
+                                                    clamp_type_uint_t type)
+{
+    if (array == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if (frac_bits == 0U || frac_bits > 31U)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    const uint64_t max = clamp_limit_uint32(type);
+    const uint64_t bias = (uint64_t) fixed_round_bias(frac_bits, mode);
+    uint32_t clamped = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+        uint64_t result = ((uint64_t) array[i] * factor + bias) >> frac_bits;
+        clamped |= (uint32_t) (result > max);
+        array[i] = (uint32_t) ((result > max) ? max : result);
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Scales each element by a Q15 factor (e.g. 0.75 = 24576, 1.3 = 42598) with rounding.
+ *
+ * The factor is stored in an `int32_t`, so gains above 1.0 are allowed. Results are rounded to
+ * nearest and saturated to the selected range.
+ *
+ * @param array  Pointer to the array to scale (modified in-place).
+ * @param size   Number of elements in the array.
+ * @param factor Scale factor in Q15 format (value = factor / 32768).
+ * @param type   Range to clamp against.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements scaled successfully.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_scale_q15(int32_t* array, size_t size, int32_t factor,
+                                             clamp_type_int_t type)
+{
+    return array_scale_fixed(array, size, factor, 15U, ROUNDING_NEAREST, type);
+}
+
+/**
+ * @brief Scales each element by a Q31 factor in [-1.0, 1.0) with rounding.
+ *
+ * @param array  Pointer to the array to scale (modified in-place).
+ * @param size   Number of elements in the array.
+ * @param factor Scale factor in Q31 format (value = factor / 2^31).
+ * @param type   Range to clamp against.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements scaled successfully.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_scale_q31(int32_t* array, size_t size, int32_t factor,
+                                             clamp_type_int_t type)
+{
+    return array_scale_fixed(array, size, factor, 31U, ROUNDING_NEAREST, type);
+}
+
+/**
+ * @brief Scales each element of an unsigned array by an unsigned Q15 factor with rounding.
+ *
+ * @param array  Pointer to the unsigned array to scale (modified in-place).
+ * @param size   Number of elements in the array.
+ * @param factor Scale factor in unsigned Q15 format (value = factor / 32768).
+ * @param type   Unsigned integer range to clamp against.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements scaled successfully.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_scale_q15_uint(uint32_t* array, size_t size, uint32_t factor,
+                                                  clamp_type_uint_t type)
+{
+    return array_scale_fixed_uint(array, size, factor, 15U, ROUNDING_NEAREST, type);
+}
+
+/**
+ * @brief Scales each element of an unsigned array by an unsigned Q31 factor in [0.0, 2.0).
+ *
+ * @param array  Pointer to the unsigned array to scale (modified in-place).
+ * @param size   Number of elements in the array.
+ * @param factor Scale factor in unsigned Q31 format (value = factor / 2^31).
+ * @param type   Unsigned integer range to clamp against.
+ *
+ * @retval ARRAY_STATUS_OK                     All elements scaled successfully.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP One or more values were clamped.
+ * @retval ARRAY_STATUS_ERROR_NULL             Array pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            Array size was 0.
+ */
+static inline array_status_t array_scale_q31_uint(uint32_t* array, size_t size, uint32_t factor,
+                                                  clamp_type_uint_t type)
+{
+    return array_scale_fixed_uint(array, size, factor, 31U, ROUNDING_NEAREST, type);
 }
 
 #endif // ARRAY_TRANSFORM_H
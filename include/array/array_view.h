@@ -0,0 +1,477 @@
+/**
+ * @file array_view.h
+ * @brief Read-only transform views: a source buffer plus a chain of offset / scale / clamp ops.
+ *
+ * A view never writes to its source and never allocates. Readers pull the transformed data one
+ * tile (`VIEW_TILE` elements) at a time into a small stack buffer; each op of the chain runs over
+ * the whole tile before the next one, so the tile stays in L1 and every op loop vectorizes.
+ * Each op has exactly the semantics of the corresponding in-place function of
+ * `array_transform.h`, so reading a view gives the same values as copying the source and
+ * calling `array_offset()` / `array_scale()` / `array_clamp()` on the copy.
+ *
+ * @author Eleftherios Tselegkidis
+ * @date 2026-10-18
+ */
+#ifndef ARRAY_VIEW_H
+#define ARRAY_VIEW_H
+
+#include "array_transform.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------
+//   Configuration
+// -----------------------------
+
+/** Maximum number of ops in a view chain. */
+#ifndef VIEW_MAX_OPS
+#define VIEW_MAX_OPS 8U
+#endif
+
+/** Elements materialized per tile (1 KiB of int32, comfortably L1-resident). */
+#ifndef VIEW_TILE
+#define VIEW_TILE 256U
+#endif
+
+// -----------------------------
+//   Type Definitions
+// -----------------------------
+
+/**
+ * @brief Operation applied by a view.
+ */
+typedef enum
+{
+    VIEW_OP_OFFSET, /**< `array_offset(a)` */
+    VIEW_OP_SCALE,  /**< `array_scale(a)` */
+    VIEW_OP_CLAMP   /**< `array_clamp(a, b)` */
+} view_op_type_t;
+
+/**
+ * @brief One step of a view chain.
+ */
+typedef struct
+{
+    view_op_type_t op; /**< Operation */
+    int32_t a;         /**< Offset, factor or clamp minimum */
+    int32_t b;         /**< Clamp maximum (unused otherwise) */
+} view_op_t;
+
+/**
+ * @brief Lazily evaluated `op_n(...op_1(source))`.
+ */
+typedef struct
+{
+    const int32_t* source;       /**< Untransformed data (never written) */
+    size_t size;                 /**< Number of elements */
+    clamp_type_int_t type;       /**< Range that offsets and scales saturate against */
+    view_op_t ops[VIEW_MAX_OPS]; /**< Chain, applied in order */
+    size_t op_count;             /**< Number of ops in the chain */
+} array_view_t;
+
+/**
+ * @brief Tile iterator over a view.
+ */
+typedef struct
+{
+    const array_view_t* view; /**< View being read */
+    size_t pos;               /**< Index of the next element to produce */
+    bool clamped;             /**< An offset / scale saturated in a produced tile */
+    int32_t tile[VIEW_TILE];  /**< Current tile */
+} array_view_iter_t;
+
+// -----------------------------
+//   Building a view
+// -----------------------------
+
+/**
+ * @brief Creates a view with an empty chain (reads return the source unchanged).
+ *
+ * @param view   Pointer to the view.
+ * @param source Source buffer (must outlive the view).
+ * @param size   Number of elements.
+ * @param type   Range that offsets and scales saturate against.
+ *
+ * @retval ARRAY_STATUS_OK          View ready.
+ * @retval ARRAY_STATUS_ERROR_NULL  NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY Array size was 0.
+ */
+static inline array_status_t array_view_init(array_view_t* view, const int32_t* source,
+                                             size_t size, clamp_type_int_t type)
+{
+    if (view == NULL || source == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (size == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    view->source = source;
+    view->size = size;
+    view->type = type;
+    view->op_count = 0U;
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Appends an op to the chain.
+ *
+ * @retval ARRAY_STATUS_OK                  Op appended.
+ * @retval ARRAY_STATUS_ERROR_NULL          View pointer was NULL.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT Chain full (VIEW_MAX_OPS) or clamp min > max.
+ */
+static inline array_status_t view_push(array_view_t* view, view_op_type_t op, int32_t a,
+                                       int32_t b)
+{
+    if (view == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (view->op_count >= VIEW_MAX_OPS || (op == VIEW_OP_CLAMP && a > b))
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    view->ops[view->op_count].op = op;
+    view->ops[view->op_count].a = a;
+    view->ops[view->op_count].b = b;
+    view->op_count++;
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Appends `array_offset(offset)` to the chain.
+ *
+ * @see view_push()
+ */
+static inline array_status_t array_view_offset(array_view_t* view, int32_t offset)
+{
+    return view_push(view, VIEW_OP_OFFSET, offset, 0);
+}
+
+/**
+ * @brief Appends `array_scale(factor)` to the chain.
+ *
+ * @see view_push()
+ */
+static inline array_status_t array_view_scale(array_view_t* view, int32_t factor)
+{
+    return view_push(view, VIEW_OP_SCALE, factor, 0);
+}
+
+/**
+ * @brief Appends `array_clamp(min, max)` to the chain.
+ *
+ * @see view_push()
+ */
+static inline array_status_t array_view_clamp(array_view_t* view, int32_t min, int32_t max)
+{
+    return view_push(view, VIEW_OP_CLAMP, min, max);
+}
+
+// -----------------------------
+//   Reading
+// -----------------------------
+
+/**
+ * @brief Applies one op to a tile in place (same semantics as `array_transform.h`).
+ *
+ * @return Non-zero if an offset or scale saturated.
+ */
+static inline uint32_t view_apply_op(const view_op_t* op, clamp_type_int_t type, int32_t* tile,
+                                     size_t count)
+{
+    int32_t min = INT32_MIN;
+    int32_t max = INT32_MAX;
+    clamp_limits_int32(type, &min, &max);
+
+    int64_t lower = min;
+    int64_t upper = max;
+    uint32_t clamped = 0U;
+
+    switch (op->op)
+    {
+    case VIEW_OP_OFFSET:
+        // Only the limit in the direction of the offset can be crossed
+        lower = (op->a < 0) ? min : INT64_MIN;
+        upper = (op->a > 0) ? max : INT64_MAX;
+        for (size_t i = 0U; i < count; ++i)
+        {
+            int64_t value = (int64_t) tile[i] + op->a;
+            clamped |= (uint32_t) ((value < lower) | (value > upper));
+            value = (value < lower) ? lower : value;
+            value = (value > upper) ? upper : value;
+            tile[i] = (int32_t) value;
+        }
+        return clamped;
+
+    case VIEW_OP_SCALE:
+        for (size_t i = 0U; i < count; ++i)
+        {
+            int64_t value = (int64_t) tile[i] * op->a;
+            clamped |= (uint32_t) ((value < lower) | (value > upper));
+            value = (value < lower) ? lower : value;
+            value = (value > upper) ? upper : value;
+            tile[i] = (int32_t) value;
+        }
+        return clamped;
+
+    default:
+        for (size_t i = 0U; i < count; ++i)
+        {
+            int32_t value = tile[i];
+            value = (value < op->a) ? op->a : value;
+            value = (value > op->b) ? op->b : value;
+            tile[i] = value;
+        }
+        return 0U;
+    }
+}
+
+/**
+ * @brief Materializes elements [start, start + count) of the view into `dst`.
+ *
+ * The range is processed in tiles of `VIEW_TILE` elements so that all ops of the chain run on
+ * cache-resident data.
+ *
+ * @param view  Pointer to an initialized view.
+ * @param start Index of the first element.
+ * @param count Number of elements (start + count <= view size).
+ * @param dst   Output buffer of at least `count` elements.
+ *
+ * @retval ARRAY_STATUS_OK                     Range written.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP An offset or scale saturated in the range.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ * @retval ARRAY_STATUS_ERROR_EMPTY            count was 0.
+ * @retval ARRAY_STATUS_ERROR_INVALID_INPUT    Range exceeds the view.
+ */
+static inline array_status_t array_view_read(const array_view_t* view, size_t start,
+                                             size_t count, int32_t* dst)
+{
+    if (view == NULL || dst == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    if (count == 0U)
+    {
+        return ARRAY_STATUS_ERROR_EMPTY;
+    }
+
+    if (start > view->size || count > view->size - start)
+    {
+        return ARRAY_STATUS_ERROR_INVALID_INPUT;
+    }
+
+    uint32_t clamped = 0U;
+
+    for (size_t base = 0U; base < count; base += VIEW_TILE)
+    {
+        size_t n = (count - base < VIEW_TILE) ? count - base : VIEW_TILE;
+        int32_t* tile = &dst[base];
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+            tile[i] = view->source[start + base + i];
+        }
+
+        for (size_t k = 0U; k < view->op_count; ++k)
+        {
+            clamped |= view_apply_op(&view->ops[k], view->type, tile, n);
+        }
+    }
+
+    return clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Starts iterating over a view tile by tile.
+ *
+ * @param iter Pointer to the iterator (holds the tile buffer, usually on the stack).
+ * @param view Pointer to an initialized view.
+ *
+ * @retval ARRAY_STATUS_OK         Iterator ready.
+ * @retval ARRAY_STATUS_ERROR_NULL NULL pointer was passed.
+ */
+static inline array_status_t array_view_iter_init(array_view_iter_t* iter,
+                                                  const array_view_t* view)
+{
+    if (iter == NULL || view == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    iter->view = view;
+    iter->pos = 0U;
+    iter->clamped = false;
+    return ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Produces the next tile of the view.
+ *
+ * @param iter      Pointer to an initialized iterator.
+ * @param out_tile  Pointer set to the tile (valid until the next call).
+ * @param out_count Pointer set to the number of elements in the tile.
+ *
+ * @retval true  A tile was produced.
+ * @retval false The view is exhausted (or a NULL pointer was passed).
+ */
+static inline bool array_view_iter_next(array_view_iter_t* iter, const int32_t** out_tile,
+                                        size_t* out_count)
+{
+    if (iter == NULL || out_tile == NULL || out_count == NULL || iter->pos >= iter->view->size)
+    {
+        return false;
+    }
+
+    size_t remaining = iter->view->size - iter->pos;
+    size_t n = (remaining < VIEW_TILE) ? remaining : VIEW_TILE;
+
+    if (array_view_read(iter->view, iter->pos, n, iter->tile) ==
+        ARRAY_STATUS_WARNING_OVERFLOW_CLAMP)
+    {
+        iter->clamped = true;
+    }
+
+    iter->pos += n;
+    *out_tile = iter->tile;
+    *out_count = n;
+    return true;
+}
+
+// -----------------------------
+//   Statistics over views
+// -----------------------------
+
+/**
+ * @brief Min, max and sum of a view in one tiled pass (no full-size temporary).
+ *
+ * @param view    Pointer to an initialized view.
+ * @param out_min Optional pointer for the minimum (may be NULL).
+ * @param out_max Optional pointer for the maximum (may be NULL).
+ * @param out_sum Optional pointer for the sum (may be NULL).
+ *
+ * @retval ARRAY_STATUS_OK                     Success.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP An offset / scale saturated while reading the view.
+ * @retval ARRAY_STATUS_ERROR_NULL             View pointer was NULL.
+ */
+static inline array_status_t array_view_stats(const array_view_t* view, int32_t* out_min,
+                                              int32_t* out_max, int64_t* out_sum)
+{
+    if (view == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    array_view_iter_t iter;
+    const int32_t* tile = NULL;
+    size_t count = 0U;
+    int32_t min = INT32_MAX;
+    int32_t max = INT32_MIN;
+    int64_t sum = 0;
+
+    array_view_iter_init(&iter, view);
+    while (array_view_iter_next(&iter, &tile, &count))
+    {
+        for (size_t i = 0U; i < count; ++i)
+        {
+            min = (tile[i] < min) ? tile[i] : min;
+            max = (tile[i] > max) ? tile[i] : max;
+            sum += tile[i];
+        }
+    }
+
+    if (out_min != NULL)
+    {
+        *out_min = min;
+    }
+    if (out_max != NULL)
+    {
+        *out_max = max;
+    }
+    if (out_sum != NULL)
+    {
+        *out_sum = sum;
+    }
+
+    return iter.clamped ? ARRAY_STATUS_WARNING_OVERFLOW_CLAMP : ARRAY_STATUS_OK;
+}
+
+/**
+ * @brief Minimum value of a view.
+ *
+ * @retval ARRAY_STATUS_OK                     Success.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP An offset / scale saturated while reading the view.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ */
+static inline array_status_t array_view_min(const array_view_t* view, int32_t* out_min)
+{
+    if (out_min == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    return array_view_stats(view, out_min, NULL, NULL);
+}
+
+/**
+ * @brief Maximum value of a view.
+ *
+ * @retval ARRAY_STATUS_OK                     Success.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP An offset / scale saturated while reading the view.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ */
+static inline array_status_t array_view_max(const array_view_t* view, int32_t* out_max)
+{
+    if (out_max == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    return array_view_stats(view, NULL, out_max, NULL);
+}
+
+/**
+ * @brief Sum of a view (int64, cannot overflow for any realistic size).
+ *
+ * @retval ARRAY_STATUS_OK                     Success.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP An offset / scale saturated while reading the view.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ */
+static inline array_status_t array_view_sum(const array_view_t* view, int64_t* out_sum)
+{
+    if (out_sum == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    return array_view_stats(view, NULL, NULL, out_sum);
+}
+
+/**
+ * @brief Mean of a view (truncated toward zero, like `array_mean()`).
+ *
+ * @retval ARRAY_STATUS_OK                     Success.
+ * @retval ARRAY_STATUS_WARNING_OVERFLOW_CLAMP An offset / scale saturated while reading the view.
+ * @retval ARRAY_STATUS_ERROR_NULL             NULL pointer was passed.
+ */
+static inline array_status_t array_view_mean(const array_view_t* view, int32_t* out_mean)
+{
+    if (view == NULL || out_mean == NULL)
+    {
+        return ARRAY_STATUS_ERROR_NULL;
+    }
+
+    int64_t sum = 0;
+    array_status_t status = array_view_stats(view, NULL, NULL, &sum);
+    *out_mean = (int32_t) (sum / (int64_t) view->size);
+    return status;
+}
+
+#endif // ARRAY_VIEW_H
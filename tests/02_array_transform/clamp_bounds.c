@@ -0,0 +1,84 @@
+#include "array/array_transform.h"
+#include "unity.h"
+
+// ----------- array_clamp_bounds tests -----------
+void test_array_clamp_bounds_should_use_per_element_limits(void)
+{
+    int32_t arr[] = {-10, 5, 50, 7, 100};
+    const int32_t lo[] = {0, 0, 0, 10, -5};
+    const int32_t hi[] = {10, 10, 20, 20, 5};
+    const int32_t expected[] = {0, 5, 20, 10, 5};
+
+    array_status_t status = array_clamp_bounds(arr, lo, hi, 5);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected, arr, 5);
+}
+
+void test_array_clamp_bounds_report_should_count_clamped_elements(void)
+{
+    int32_t arr[] = {INT32_MIN, 1, INT32_MAX};
+    const int32_t lo[] = {-1, -1, -1};
+    const int32_t hi[] = {1, 1, 1};
+    size_t count = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_clamp_bounds_report(arr, lo, hi, 3, &count));
+    TEST_ASSERT_EQUAL_size_t(2U, count);
+}
+
+void test_array_clamp_bounds_should_not_modify_array_on_invalid_bounds(void)
+{
+    int32_t arr[] = {100, 100};
+    const int32_t lo[] = {0, 5};
+    const int32_t hi[] = {10, 4};
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT, array_clamp_bounds(arr, lo, hi, 2));
+    TEST_ASSERT_EQUAL_INT32(100, arr[0]);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_clamp_bounds(arr, NULL, hi, 2));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_clamp_bounds(arr, lo, hi, 0));
+}
+
+// ----------- array_clamp_bounds_channels tests -----------
+void test_array_clamp_bounds_channels_should_broadcast_per_channel(void)
+{
+    // 3 channels, 3 frames
+    int32_t arr[] = {-5, 50, 500, 5, -50, 0, 15, 25, -500};
+    const int32_t lo[] = {0, -10, -100};
+    const int32_t hi[] = {10, 10, 100};
+    const int32_t expected[] = {0, 10, 100, 5, -10, 0, 10, 10, -100};
+    size_t count = 0U;
+
+    array_status_t status = array_clamp_bounds_channels(arr, 9, lo, hi, 3, &count);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_size_t(7U, count);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected, arr, 9);
+}
+
+void test_array_clamp_bounds_channels_should_reject_partial_frames(void)
+{
+    int32_t arr[] = {1, 2, 3};
+    const int32_t lo[] = {0, 0};
+    const int32_t hi[] = {1, 1};
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_clamp_bounds_channels(arr, 3, lo, hi, 2, NULL));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY,
+                      array_clamp_bounds_channels(arr, 3, lo, hi, 0, NULL));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- array_clamp_bounds tests -----------
+    RUN_TEST(test_array_clamp_bounds_should_use_per_element_limits);
+    RUN_TEST(test_array_clamp_bounds_report_should_count_clamped_elements);
+    RUN_TEST(test_array_clamp_bounds_should_not_modify_array_on_invalid_bounds);
+
+    // ----------- array_clamp_bounds_channels tests -----------
+    RUN_TEST(test_array_clamp_bounds_channels_should_broadcast_per_channel);
+    RUN_TEST(test_array_clamp_bounds_channels_should_reject_partial_frames);
+
+    return UNITY_END();
+}
@@ -0,0 +1,147 @@
+#include "array/array_transform.h"
+#include "unity.h"
+
+#define REPORT_SIZE 130U
+
+// ----------- array_clamp_report tests -----------
+void test_array_clamp_report_should_count_and_mask_clamped_elements(void)
+{
+    int32_t arr[] = {-5, 0, 3, 9, 4};
+    size_t count = 0U;
+    uint64_t mask[CLAMP_MASK_WORDS(5U)] = {0};
+
+    array_status_t status = array_clamp_report(arr, 5, 0, 4, &count, mask);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_size_t(2U, count);
+    TEST_ASSERT_EQUAL_HEX64(0x9U, mask[0]); // elements 0 and 3
+    TEST_ASSERT_EQUAL_INT32(0, arr[0]);
+    TEST_ASSERT_EQUAL_INT32(4, arr[3]);
+}
+
+void test_array_clamp_report_should_span_multiple_mask_words(void)
+{
+    int32_t arr[REPORT_SIZE];
+    uint64_t mask[CLAMP_MASK_WORDS(REPORT_SIZE)];
+    size_t count = 0U;
+
+    for (size_t i = 0U; i < REPORT_SIZE; ++i)
+    {
+        arr[i] = (i == 1U || i == 64U || i == 129U) ? 1000 : 0;
+    }
+
+    array_status_t status = array_clamp_report(arr, REPORT_SIZE, -10, 10, &count, mask);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_size_t(3U, count);
+    TEST_ASSERT_EQUAL_HEX64(0x2U, mask[0]);
+    TEST_ASSERT_EQUAL_HEX64(0x1U, mask[1]);
+    TEST_ASSERT_EQUAL_HEX64(0x2U, mask[2]);
+}
+
+void test_array_clamp_report_should_accept_null_outputs(void)
+{
+    int32_t arr[] = {-5, 5};
+    array_status_t status = array_clamp_report(arr, 2, 0, 1, NULL, NULL);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT32(0, arr[0]);
+    TEST_ASSERT_EQUAL_INT32(1, arr[1]);
+}
+
+// ----------- array_offset_report tests -----------
+void test_array_offset_report_should_mark_saturated_elements(void)
+{
+    int32_t arr[] = {100, 120, -128, 27};
+    size_t count = 0U;
+    uint64_t mask[1] = {0};
+
+    array_status_t status = array_offset_report(arr, 4, 10, CLAMP_INT8, &count, mask);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_size_t(1U, count);
+    TEST_ASSERT_EQUAL_HEX64(0x2U, mask[0]);
+    TEST_ASSERT_EQUAL_INT32(110, arr[0]);
+    TEST_ASSERT_EQUAL_INT32(INT8_MAX, arr[1]);
+    TEST_ASSERT_EQUAL_INT32(-118, arr[2]);
+}
+
+void test_array_offset_report_should_clear_outputs_on_zero_offset(void)
+{
+    int32_t arr[] = {1, 2};
+    size_t count = 99U;
+    uint64_t mask[1] = {0xFFU};
+
+    array_status_t status = array_offset_report(arr, 2, 0, CLAMP_INT32, &count, mask);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OFFSET_IS_ZERO, status);
+    TEST_ASSERT_EQUAL_size_t(0U, count);
+    TEST_ASSERT_EQUAL_HEX64(0U, mask[0]);
+}
+
+void test_array_offset_uint_report_should_clamp_offset_above_limit(void)
+{
+    uint32_t arr[] = {0U, 10U};
+    size_t count = 0U;
+
+    array_status_t status = array_offset_uint_report(arr, 2, 300U, CLAMP_UINT8, &count, NULL);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_size_t(2U, count);
+    TEST_ASSERT_EQUAL_UINT32(UINT8_MAX, arr[0]);
+    TEST_ASSERT_EQUAL_UINT32(UINT8_MAX, arr[1]);
+}
+
+// ----------- array_scale_report tests -----------
+void test_array_scale_report_should_saturate_towards_product_sign(void)
+{
+    int32_t arr[] = {-100, 100, -3, 50};
+    size_t count = 0U;
+    uint64_t mask[1] = {0};
+
+    array_status_t status = array_scale_report(arr, 4, -2, CLAMP_INT8, &count, mask);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_size_t(2U, count);
+    TEST_ASSERT_EQUAL_HEX64(0x3U, mask[0]);
+    TEST_ASSERT_EQUAL_INT32(INT8_MAX, arr[0]);
+    TEST_ASSERT_EQUAL_INT32(INT8_MIN, arr[1]);
+    TEST_ASSERT_EQUAL_INT32(6, arr[2]);
+    TEST_ASSERT_EQUAL_INT32(-100, arr[3]);
+}
+
+void test_array_scale_uint_report_should_count_clamped_elements(void)
+{
+    uint32_t arr[] = {1U, 2U, 3U};
+    size_t count = 0U;
+    uint64_t mask[1] = {0};
+
+    array_status_t status = array_scale_uint_report(arr, 3, 100U, CLAMP_UINT8, &count, mask);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_size_t(1U, count);
+    TEST_ASSERT_EQUAL_HEX64(0x4U, mask[0]);
+    TEST_ASSERT_EQUAL_UINT32(200U, arr[1]);
+    TEST_ASSERT_EQUAL_UINT32(UINT8_MAX, arr[2]);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- array_clamp_report tests -----------
+    RUN_TEST(test_array_clamp_report_should_count_and_mask_clamped_elements);
+    RUN_TEST(test_array_clamp_report_should_span_multiple_mask_words);
+    RUN_TEST(test_array_clamp_report_should_accept_null_outputs);
+
+    // ----------- array_offset_report tests -----------
+    RUN_TEST(test_array_offset_report_should_mark_saturated_elements);
+    RUN_TEST(test_array_offset_report_should_clear_outputs_on_zero_offset);
+    RUN_TEST(test_array_offset_uint_report_should_clamp_offset_above_limit);
+
+    // ----------- array_scale_report tests -----------
+    RUN_TEST(test_array_scale_report_should_saturate_towards_product_sign);
+    RUN_TEST(test_array_scale_uint_report_should_count_clamped_elements);
+
+    return UNITY_END();
+}
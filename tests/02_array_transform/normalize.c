@@ -1,14 +1,140 @@
 #include "array/array_transform.h"
 #include "unity.h"
 
-void test_array_transform_clamp_valid_range(void)
+// Reference: exact floor(d * out_span / in_span) with 64-bit division
+static uint32_t reference_rescale_floor(uint32_t d, uint32_t in_span, uint32_t out_span)
 {
-    TEST_ASSERT_EQUAL_INT(1, 1);
+    return (uint32_t) (((uint64_t) d * out_span) / in_span);
+}
+
+// ----------- array_normalize tests -----------
+void test_array_normalize_should_map_min_max_to_output_range(void)
+{
+    int32_t arr[] = {10, 20, 30, 40, 50};
+    array_status_t status = array_normalize(arr, 5, 0, 255, ROUNDING_NEAREST);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT32(0, arr[0]);
+    TEST_ASSERT_EQUAL_INT32(64, arr[1]); // 63.75
+    TEST_ASSERT_EQUAL_INT32(128, arr[2]); // 127.5, tie rounds up
+    TEST_ASSERT_EQUAL_INT32(191, arr[3]); // 191.25
+    TEST_ASSERT_EQUAL_INT32(255, arr[4]);
+}
+
+void test_array_normalize_should_apply_rounding_modes(void)
+{
+    int32_t floor_arr[] = {0, 1, 2, 3};
+    int32_t ceil_arr[] = {0, 1, 2, 3};
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_normalize(floor_arr, 4, 0, 10, ROUNDING_FLOOR));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_normalize(ceil_arr, 4, 0, 10, ROUNDING_CEIL));
+
+    // Exact values: 0, 3.33, 6.67, 10
+    TEST_ASSERT_EQUAL_INT32(3, floor_arr[1]);
+    TEST_ASSERT_EQUAL_INT32(6, floor_arr[2]);
+    TEST_ASSERT_EQUAL_INT32(4, ceil_arr[1]);
+    TEST_ASSERT_EQUAL_INT32(7, ceil_arr[2]);
+    TEST_ASSERT_EQUAL_INT32(10, floor_arr[3]);
+    TEST_ASSERT_EQUAL_INT32(10, ceil_arr[3]);
+}
+
+void test_array_normalize_should_handle_full_int32_range_to_q15(void)
+{
+    int32_t arr[] = {INT32_MIN, -1, 0, 1, 123456789, INT32_MAX};
+    array_status_t status = array_normalize(arr, 6, INT16_MIN, INT16_MAX, ROUNDING_FLOOR);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT32(INT16_MIN, arr[0]);
+    TEST_ASSERT_EQUAL_INT32(INT16_MAX, arr[5]);
+
+    uint32_t d = (uint32_t) ((int64_t) 123456789 - INT32_MIN);
+    int32_t expected = INT16_MIN + (int32_t) reference_rescale_floor(d, UINT32_MAX, 65535U);
+    TEST_ASSERT_EQUAL_INT32(expected, arr[4]);
+}
+
+void test_array_normalize_should_set_constant_array_to_out_min(void)
+{
+    int32_t arr[] = {7, 7, 7};
+    array_status_t status = array_normalize(arr, 3, -5, 5, ROUNDING_NEAREST);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT32(-5, arr[0]);
+    TEST_ASSERT_EQUAL_INT32(-5, arr[2]);
+}
+
+void test_array_normalize_should_return_error_on_invalid_input(void)
+{
+    int32_t arr[] = {1, 2, 3};
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_normalize(NULL, 3, 0, 1, ROUNDING_FLOOR));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_normalize(arr, 0, 0, 1, ROUNDING_FLOOR));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_normalize(arr, 3, 10, 1, ROUNDING_FLOOR));
+}
+
+// ----------- array_normalize_range tests -----------
+void test_array_normalize_range_should_clamp_values_outside_input_range(void)
+{
+    int32_t arr[] = {-50, 0, 50, 100, 150};
+    array_status_t status = array_normalize_range(arr, 5, 0, 100, 0, 1000, ROUNDING_FLOOR);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_INT32(0, arr[0]);
+    TEST_ASSERT_EQUAL_INT32(500, arr[2]);
+    TEST_ASSERT_EQUAL_INT32(1000, arr[4]);
+}
+
+void test_array_normalize_range_should_match_exact_division(void)
+{
+    const uint32_t in_span = 1000003U;
+    const uint32_t out_span = 4000000007U;
+    uint32_t arr[64];
+
+    for (uint32_t i = 0U; i < 64U; ++i)
+    {
+        arr[i] = (i * 15625U) % (in_span + 1U);
+    }
+
+    array_status_t status =
+        array_normalize_range_uint(arr, 64, 0U, in_span, 0U, out_span, ROUNDING_FLOOR);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+
+    for (uint32_t i = 0U; i < 64U; ++i)
+    {
+        uint32_t d = (i * 15625U) % (in_span + 1U);
+        TEST_ASSERT_EQUAL_UINT32(reference_rescale_floor(d, in_span, out_span), arr[i]);
+    }
+}
+
+// ----------- array_normalize_uint tests -----------
+void test_array_normalize_uint_should_map_to_uint8_range(void)
+{
+    uint32_t arr[] = {1000U, 1500U, 2000U};
+    array_status_t status = array_normalize_uint(arr, 3, 0U, 255U, ROUNDING_NEAREST);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_UINT32(0U, arr[0]);
+    TEST_ASSERT_EQUAL_UINT32(128U, arr[1]);
+    TEST_ASSERT_EQUAL_UINT32(255U, arr[2]);
 }
 
 int main(void)
 {
     UNITY_BEGIN();
-    RUN_TEST(test_array_transform_clamp_valid_range);
+
+    // ----------- array_normalize tests -----------
+    RUN_TEST(test_array_normalize_should_map_min_max_to_output_range);
+    RUN_TEST(test_array_normalize_should_apply_rounding_modes);
+    RUN_TEST(test_array_normalize_should_handle_full_int32_range_to_q15);
+    RUN_TEST(test_array_normalize_should_set_constant_array_to_out_min);
+    RUN_TEST(test_array_normalize_should_return_error_on_invalid_input);
+
+    // ----------- array_normalize_range tests -----------
+    RUN_TEST(test_array_normalize_range_should_clamp_values_outside_input_range);
+    RUN_TEST(test_array_normalize_range_should_match_exact_division);
+
+    // ----------- array_normalize_uint tests -----------
+    RUN_TEST(test_array_normalize_uint_should_map_to_uint8_range);
+
     return UNITY_END();
 }
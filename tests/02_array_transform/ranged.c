@@ -0,0 +1,128 @@
+#include "array/array_transform.h"
+#include "unity.h"
+
+#define RANGED_SIZE 300U
+
+static int32_t fast[RANGED_SIZE];
+static int32_t checked[RANGED_SIZE];
+static uint32_t fast_u[RANGED_SIZE];
+static uint32_t checked_u[RANGED_SIZE];
+
+void setUp(void)
+{
+    for (size_t i = 0U; i < RANGED_SIZE; ++i)
+    {
+        fast[i] = (int32_t) ((i * 7919U) % 201U) - 100;
+        checked[i] = fast[i];
+        fast_u[i] = (uint32_t) ((i * 7919U) % 201U);
+        checked_u[i] = fast_u[i];
+    }
+}
+
+void tearDown(void)
+{
+}
+
+// ----------- array_minmax tests -----------
+void test_array_minmax_int32_should_find_envelope(void)
+{
+    array_range_t range;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_minmax_int32(fast, RANGED_SIZE, &range));
+    TEST_ASSERT_EQUAL_INT32(-100, range.min);
+    TEST_ASSERT_EQUAL_INT32(100, range.max);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_minmax_int32(fast, RANGED_SIZE, NULL));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_minmax_int32(fast, 0, &range));
+}
+
+// ----------- array_offset_ranged tests -----------
+void test_array_offset_ranged_should_match_array_offset_when_safe(void)
+{
+    array_status_t status = array_offset_ranged(fast, RANGED_SIZE, 27, CLAMP_INT8, NULL);
+
+    TEST_ASSERT_EQUAL(array_offset(checked, RANGED_SIZE, 27, CLAMP_INT8), status);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(checked, fast, RANGED_SIZE);
+}
+
+void test_array_offset_ranged_should_fall_back_when_envelope_crosses_limit(void)
+{
+    array_status_t status = array_offset_ranged(fast, RANGED_SIZE, -50, CLAMP_INT8, NULL);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL(status, array_offset(checked, RANGED_SIZE, -50, CLAMP_INT8));
+    TEST_ASSERT_EQUAL_INT32_ARRAY(checked, fast, RANGED_SIZE);
+}
+
+void test_array_offset_ranged_should_use_known_bounds(void)
+{
+    // A loose (but valid) envelope that crosses the limit forces the checked loop
+    const array_range_t loose = {-100, 120};
+
+    array_status_t status = array_offset_ranged(fast, RANGED_SIZE, 20, CLAMP_INT8, &loose);
+
+    TEST_ASSERT_EQUAL(array_offset(checked, RANGED_SIZE, 20, CLAMP_INT8), status);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(checked, fast, RANGED_SIZE);
+}
+
+void test_array_offset_uint_ranged_should_match_array_offset_uint(void)
+{
+    const uint32_t offsets[] = {54U, 55U};
+
+    for (size_t k = 0U; k < 2U; ++k)
+    {
+        array_status_t status =
+            array_offset_uint_ranged(fast_u, RANGED_SIZE, offsets[k], CLAMP_UINT8, NULL);
+
+        TEST_ASSERT_EQUAL(array_offset_uint(checked_u, RANGED_SIZE, offsets[k], CLAMP_UINT8),
+                          status);
+        TEST_ASSERT_EQUAL_UINT32_ARRAY(checked_u, fast_u, RANGED_SIZE);
+    }
+}
+
+// ----------- array_scale_ranged tests -----------
+void test_array_scale_ranged_should_match_array_scale(void)
+{
+    const int32_t factors[] = {-300, 327, 328, -1};
+
+    for (size_t k = 0U; k < 4U; ++k)
+    {
+        array_status_t status =
+            array_scale_ranged(fast, RANGED_SIZE, factors[k], CLAMP_INT16, NULL);
+
+        TEST_ASSERT_EQUAL(array_scale(checked, RANGED_SIZE, factors[k], CLAMP_INT16), status);
+        TEST_ASSERT_EQUAL_INT32_ARRAY(checked, fast, RANGED_SIZE);
+    }
+}
+
+void test_array_scale_uint_ranged_should_match_array_scale_uint(void)
+{
+    const array_range_uint_t known = {0U, 200U};
+
+    array_status_t status =
+        array_scale_uint_ranged(fast_u, RANGED_SIZE, 327U, CLAMP_UINT16, &known);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL(status, array_scale_uint(checked_u, RANGED_SIZE, 327U, CLAMP_UINT16));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(checked_u, fast_u, RANGED_SIZE);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- array_minmax tests -----------
+    RUN_TEST(test_array_minmax_int32_should_find_envelope);
+
+    // ----------- array_offset_ranged tests -----------
+    RUN_TEST(test_array_offset_ranged_should_match_array_offset_when_safe);
+    RUN_TEST(test_array_offset_ranged_should_fall_back_when_envelope_crosses_limit);
+    RUN_TEST(test_array_offset_ranged_should_use_known_bounds);
+    RUN_TEST(test_array_offset_uint_ranged_should_match_array_offset_uint);
+
+    // ----------- array_scale_ranged tests -----------
+    RUN_TEST(test_array_scale_ranged_should_match_array_scale);
+    RUN_TEST(test_array_scale_uint_ranged_should_match_array_scale_uint);
+
+    return UNITY_END();
+}
@@ -0,0 +1,148 @@
+#include "array/array_transform.h"
+#include "unity.h"
+
+#define Q15(x) ((int32_t) ((x) * 32768.0 + 0.5))
+
+// ----------- array_scale_q15 tests -----------
+void test_array_scale_q15_should_scale_by_fraction(void)
+{
+    int32_t arr[] = {100, -100, 7, 0};
+    array_status_t status = array_scale_q15(arr, 4, Q15(0.75), CLAMP_INT32);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT32(75, arr[0]);
+    TEST_ASSERT_EQUAL_INT32(-75, arr[1]);
+    TEST_ASSERT_EQUAL_INT32(5, arr[2]); // 5.25
+    TEST_ASSERT_EQUAL_INT32(0, arr[3]);
+}
+
+void test_array_scale_q15_should_allow_gain_above_one(void)
+{
+    int32_t arr[] = {1000, -1000};
+    array_status_t status = array_scale_q15(arr, 2, Q15(1.3), CLAMP_INT32);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT32(1300, arr[0]);
+    TEST_ASSERT_EQUAL_INT32(-1300, arr[1]);
+}
+
+void test_array_scale_q15_should_round_to_nearest(void)
+{
+    int32_t arr[] = {3, -3, 1};
+    array_status_t status = array_scale_q15(arr, 3, Q15(0.5), CLAMP_INT32);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT32(2, arr[0]);  // 1.5 -> 2
+    TEST_ASSERT_EQUAL_INT32(-1, arr[1]); // -1.5 -> -1 (ties rounded up)
+    TEST_ASSERT_EQUAL_INT32(1, arr[2]);  // 0.5 -> 1
+}
+
+void test_array_scale_q15_should_clamp_to_int8(void)
+{
+    int32_t arr[] = {100, -100, 50};
+    array_status_t status = array_scale_q15(arr, 3, Q15(1.5), CLAMP_INT8);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_INT32(INT8_MAX, arr[0]);
+    TEST_ASSERT_EQUAL_INT32(INT8_MIN, arr[1]);
+    TEST_ASSERT_EQUAL_INT32(75, arr[2]);
+}
+
+// ----------- array_scale_q31 tests -----------
+void test_array_scale_q31_should_saturate_minus_one_squared(void)
+{
+    int32_t arr[] = {INT32_MIN, INT32_MAX};
+    array_status_t status = array_scale_q31(arr, 2, INT32_MIN, CLAMP_INT32);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, arr[0]);
+    TEST_ASSERT_EQUAL_INT32(-INT32_MAX, arr[1]);
+}
+
+void test_array_scale_q31_should_halve(void)
+{
+    int32_t arr[] = {1000000, -7};
+    array_status_t status = array_scale_q31(arr, 2, 1 << 30, CLAMP_INT32);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT32(500000, arr[0]);
+    TEST_ASSERT_EQUAL_INT32(-3, arr[1]); // -3.5 -> -3
+}
+
+// ----------- array_scale_fixed tests -----------
+void test_array_scale_fixed_should_apply_rounding_modes(void)
+{
+    int32_t floor_arr[] = {5, -5};
+    int32_t ceil_arr[] = {5, -5};
+
+    // factor 0.25 in Q8
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                      array_scale_fixed(floor_arr, 2, 64, 8U, ROUNDING_FLOOR, CLAMP_INT32));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                      array_scale_fixed(ceil_arr, 2, 64, 8U, ROUNDING_CEIL, CLAMP_INT32));
+
+    TEST_ASSERT_EQUAL_INT32(1, floor_arr[0]);
+    TEST_ASSERT_EQUAL_INT32(-2, floor_arr[1]);
+    TEST_ASSERT_EQUAL_INT32(2, ceil_arr[0]);
+    TEST_ASSERT_EQUAL_INT32(-1, ceil_arr[1]);
+}
+
+void test_array_scale_fixed_should_return_error_on_invalid_input(void)
+{
+    int32_t arr[] = {1};
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL,
+                      array_scale_fixed(NULL, 1, 1, 15U, ROUNDING_NEAREST, CLAMP_INT32));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY,
+                      array_scale_fixed(arr, 0, 1, 15U, ROUNDING_NEAREST, CLAMP_INT32));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_scale_fixed(arr, 1, 1, 0U, ROUNDING_NEAREST, CLAMP_INT32));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_scale_fixed(arr, 1, 1, 32U, ROUNDING_NEAREST, CLAMP_INT32));
+}
+
+// ----------- unsigned tests -----------
+void test_array_scale_q15_uint_should_scale_and_clamp(void)
+{
+    uint32_t arr[] = {200U, 100U};
+    array_status_t status = array_scale_q15_uint(arr, 2, (uint32_t) Q15(1.3), CLAMP_UINT8);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_UINT32(UINT8_MAX, arr[0]);
+    TEST_ASSERT_EQUAL_UINT32(130U, arr[1]);
+}
+
+void test_array_scale_q31_uint_should_handle_full_range(void)
+{
+    uint32_t arr[] = {UINT32_MAX, 10U};
+    array_status_t status = array_scale_q31_uint(arr, 2, 3U << 30, CLAMP_UINT32); // 1.5
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, arr[0]);
+    TEST_ASSERT_EQUAL_UINT32(15U, arr[1]);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- array_scale_q15 tests -----------
+    RUN_TEST(test_array_scale_q15_should_scale_by_fraction);
+    RUN_TEST(test_array_scale_q15_should_allow_gain_above_one);
+    RUN_TEST(test_array_scale_q15_should_round_to_nearest);
+    RUN_TEST(test_array_scale_q15_should_clamp_to_int8);
+
+    // ----------- array_scale_q31 tests -----------
+    RUN_TEST(test_array_scale_q31_should_saturate_minus_one_squared);
+    RUN_TEST(test_array_scale_q31_should_halve);
+
+    // ----------- array_scale_fixed tests -----------
+    RUN_TEST(test_array_scale_fixed_should_apply_rounding_modes);
+    RUN_TEST(test_array_scale_fixed_should_return_error_on_invalid_input);
+
+    // ----------- unsigned tests -----------
+    RUN_TEST(test_array_scale_q15_uint_should_scale_and_clamp);
+    RUN_TEST(test_array_scale_q31_uint_should_handle_full_range);
+
+    return UNITY_END();
+}
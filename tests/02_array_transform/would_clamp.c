@@ -0,0 +1,100 @@
+#include "array/array_transform.h"
+#include "unity.h"
+
+#define PREDICT_SIZE 1000U
+
+// ----------- array_offset_would_clamp tests -----------
+void test_array_offset_would_clamp_should_find_first_offending_index(void)
+{
+    static int32_t arr[PREDICT_SIZE];
+    size_t index = 0U;
+
+    for (size_t i = 0U; i < PREDICT_SIZE; ++i)
+    {
+        arr[i] = (i == 700U || i == 900U) ? 120 : 0;
+    }
+
+    array_status_t status = array_offset_would_clamp(arr, PREDICT_SIZE, 10, CLAMP_INT8, &index);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_size_t(700U, index);
+    TEST_ASSERT_EQUAL_INT32(120, arr[700]); // not modified
+}
+
+void test_array_offset_would_clamp_should_agree_with_array_offset(void)
+{
+    int32_t arr[] = {INT16_MIN, -5, 0, 5, INT16_MAX};
+    size_t index = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                      array_offset_would_clamp(arr, 5, 0x7FFF, CLAMP_INT32, &index));
+    TEST_ASSERT_EQUAL_size_t(5U, index);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_offset(arr, 5, 0x7FFF, CLAMP_INT32));
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP,
+                      array_offset_would_clamp(arr, 5, -40000, CLAMP_INT16, &index));
+    TEST_ASSERT_EQUAL_size_t(0U, index);
+}
+
+void test_array_offset_would_clamp_should_report_zero_offset_and_errors(void)
+{
+    const int32_t arr[] = {1};
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OFFSET_IS_ZERO,
+                      array_offset_would_clamp(arr, 1, 0, CLAMP_INT8, NULL));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL,
+                      array_offset_would_clamp(NULL, 1, 1, CLAMP_INT8, NULL));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY,
+                      array_offset_would_clamp(arr, 0, 1, CLAMP_INT8, NULL));
+}
+
+void test_array_offset_uint_would_clamp_should_detect_overflow(void)
+{
+    const uint32_t arr[] = {0U, 200U, 250U};
+    size_t index = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP,
+                      array_offset_uint_would_clamp(arr, 3, 10U, CLAMP_UINT8, &index));
+    TEST_ASSERT_EQUAL_size_t(2U, index);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                      array_offset_uint_would_clamp(arr, 3, 5U, CLAMP_UINT8, NULL));
+}
+
+// ----------- array_scale_would_clamp tests -----------
+void test_array_scale_would_clamp_should_detect_both_signs(void)
+{
+    const int32_t arr[] = {1000, -1000, 20000};
+    size_t index = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_scale_would_clamp(arr, 2, -32, CLAMP_INT16, &index));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP,
+                      array_scale_would_clamp(arr, 3, -2, CLAMP_INT16, &index));
+    TEST_ASSERT_EQUAL_size_t(2U, index);
+}
+
+void test_array_scale_uint_would_clamp_should_detect_overflow(void)
+{
+    const uint32_t arr[] = {1U, UINT32_MAX / 2U, UINT32_MAX / 2U + 1U};
+    size_t index = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP,
+                      array_scale_uint_would_clamp(arr, 3, 2U, CLAMP_UINT32, &index));
+    TEST_ASSERT_EQUAL_size_t(2U, index);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- array_offset_would_clamp tests -----------
+    RUN_TEST(test_array_offset_would_clamp_should_find_first_offending_index);
+    RUN_TEST(test_array_offset_would_clamp_should_agree_with_array_offset);
+    RUN_TEST(test_array_offset_would_clamp_should_report_zero_offset_and_errors);
+    RUN_TEST(test_array_offset_uint_would_clamp_should_detect_overflow);
+
+    // ----------- array_scale_would_clamp tests -----------
+    RUN_TEST(test_array_scale_would_clamp_should_detect_both_signs);
+    RUN_TEST(test_array_scale_uint_would_clamp_should_detect_overflow);
+
+    return UNITY_END();
+}
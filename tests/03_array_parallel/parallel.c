@@ -0,0 +1,149 @@
+#include "array/array_parallel.h"
+#include "unity.h"
+
+#define PARALLEL_SIZE 10007U
+#define PARALLEL_THREADS 4U
+#define PARALLEL_GRAIN 256U
+
+static array_parallel_pool_t pool;
+static int32_t data_s[PARALLEL_SIZE + 1U];
+static int32_t expected_s[PARALLEL_SIZE + 1U];
+static uint32_t data_u[PARALLEL_SIZE];
+static uint32_t expected_u[PARALLEL_SIZE];
+
+void setUp(void)
+{
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_parallel_pool_init(&pool, PARALLEL_THREADS));
+    pool.min_grain = PARALLEL_GRAIN;
+
+    for (size_t i = 0U; i < PARALLEL_SIZE + 1U; ++i)
+    {
+        data_s[i] = (int32_t) ((i * 2654435761U) % 2001U) - 1000;
+        expected_s[i] = data_s[i];
+    }
+
+    for (size_t i = 0U; i < PARALLEL_SIZE; ++i)
+    {
+        data_u[i] = (uint32_t) ((i * 40503U) % 300U);
+        expected_u[i] = data_u[i];
+    }
+}
+
+void tearDown(void)
+{
+    array_parallel_pool_destroy(&pool);
+}
+
+// ----------- chunk planning tests -----------
+void test_array_parallel_plan_should_align_chunk_boundaries(void)
+{
+    size_t head = 0U;
+    size_t chunk = 0U;
+    const int32_t* base = &data_s[1]; // deliberately misaligned start
+    size_t count = array_parallel_plan(base, PARALLEL_SIZE, sizeof(int32_t), 5U, PARALLEL_GRAIN,
+                                       &head, &chunk);
+
+    TEST_ASSERT_TRUE(count > 1U);
+    TEST_ASSERT_EQUAL_size_t(0U, chunk % (ARRAY_PARALLEL_CACHE_LINE / sizeof(int32_t)));
+
+    for (size_t k = 1U; k < count; ++k)
+    {
+        size_t start = array_parallel_chunk_start(k, PARALLEL_SIZE, head, chunk);
+        TEST_ASSERT_EQUAL_size_t(0U, (uintptr_t) &base[start] % ARRAY_PARALLEL_CACHE_LINE);
+    }
+
+    TEST_ASSERT_EQUAL_size_t(PARALLEL_SIZE,
+                             array_parallel_chunk_start(count, PARALLEL_SIZE, head, chunk));
+}
+
+void test_array_parallel_plan_should_stay_serial_below_min_grain(void)
+{
+    size_t head = 0U;
+    size_t chunk = 0U;
+    size_t count =
+        array_parallel_plan(data_s, 100U, sizeof(int32_t), 5U, PARALLEL_GRAIN, &head, &chunk);
+
+    TEST_ASSERT_EQUAL_size_t(1U, count);
+}
+
+// ----------- parallel transform tests -----------
+void test_array_offset_parallel_should_match_serial(void)
+{
+    array_status_t serial = array_offset(&expected_s[1], PARALLEL_SIZE, 100, CLAMP_INT8);
+    array_status_t status = array_offset_parallel(&pool, &data_s[1], PARALLEL_SIZE, 100, CLAMP_INT8);
+
+    TEST_ASSERT_EQUAL(serial, status);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected_s, data_s, PARALLEL_SIZE + 1U);
+}
+
+void test_array_scale_parallel_should_report_ok_without_clamping(void)
+{
+    array_status_t status = array_scale_parallel(&pool, data_s, PARALLEL_SIZE, 3, CLAMP_INT32);
+    array_scale(expected_s, PARALLEL_SIZE, 3, CLAMP_INT32);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected_s, data_s, PARALLEL_SIZE);
+}
+
+void test_array_clamp_parallel_should_report_clamped_chunks(void)
+{
+    array_status_t status = array_clamp_parallel(&pool, data_s, PARALLEL_SIZE, -10, 10);
+    array_clamp(expected_s, PARALLEL_SIZE, -10, 10);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected_s, data_s, PARALLEL_SIZE);
+}
+
+void test_array_uint_parallel_should_match_serial(void)
+{
+    array_status_t status = array_offset_uint_parallel(&pool, data_u, PARALLEL_SIZE, 10U,
+                                                       CLAMP_UINT8);
+    array_offset_uint(expected_u, PARALLEL_SIZE, 10U, CLAMP_UINT8);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+
+    status = array_scale_uint_parallel(&pool, data_u, PARALLEL_SIZE, 2U, CLAMP_UINT16);
+    array_scale_uint(expected_u, PARALLEL_SIZE, 2U, CLAMP_UINT16);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected_u, data_u, PARALLEL_SIZE);
+}
+
+void test_array_parallel_should_run_serially_without_pool(void)
+{
+    array_status_t status = array_offset_parallel(NULL, data_s, PARALLEL_SIZE, 5, CLAMP_INT32);
+    array_offset(expected_s, PARALLEL_SIZE, 5, CLAMP_INT32);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected_s, data_s, PARALLEL_SIZE);
+}
+
+void test_array_parallel_should_return_errors_before_dispatch(void)
+{
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_clamp_parallel(&pool, NULL, 10U, 0, 1));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_clamp_parallel(&pool, data_s, 0U, 0, 1));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_clamp_parallel(&pool, data_s, 10U, 1, 0));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OFFSET_IS_ZERO,
+                      array_offset_parallel(&pool, data_s, 10U, 0, CLAMP_INT32));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- chunk planning tests -----------
+    RUN_TEST(test_array_parallel_plan_should_align_chunk_boundaries);
+    RUN_TEST(test_array_parallel_plan_should_stay_serial_below_min_grain);
+
+    // ----------- parallel transform tests -----------
+    RUN_TEST(test_array_offset_parallel_should_match_serial);
+    RUN_TEST(test_array_scale_parallel_should_report_ok_without_clamping);
+    RUN_TEST(test_array_clamp_parallel_should_report_clamped_chunks);
+    RUN_TEST(test_array_uint_parallel_should_match_serial);
+    RUN_TEST(test_array_parallel_should_run_serially_without_pool);
+    RUN_TEST(test_array_parallel_should_return_errors_before_dispatch);
+
+    return UNITY_END();
+}
@@ -0,0 +1,135 @@
+#include "array/array_lut.h"
+#include "common_macros.h" // for ARRAY_SIZE(), BIT()
+#include "unity.h"
+
+// ----------- array_lut_build tests -----------
+void test_array_lut_build_uint8_should_match_sequential_kernels(void)
+{
+    const lut_op_t ops[] = {{LUT_OP_OFFSET, 50, 0}, {LUT_OP_SCALE, 2, 0}};
+    array_lut_t lut;
+    uint32_t expected[256];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_lut_build_uint8(&lut, ops, ARRAY_SIZE(ops)));
+
+    for (uint32_t i = 0U; i < 256U; ++i)
+    {
+        expected[i] = i;
+    }
+    array_offset_uint(expected, 256U, 50U, CLAMP_UINT8);
+    array_scale_uint(expected, 256U, 2U, CLAMP_UINT8);
+
+    for (uint32_t i = 0U; i < 256U; ++i)
+    {
+        TEST_ASSERT_EQUAL_UINT8(expected[i], lut.table[i]);
+    }
+
+    // 77 + 50 = 127 -> 254 fits; 78 + 50 = 128 -> 256 saturates
+    TEST_ASSERT_EQUAL_HEX64(0U, lut.saturated[1] & BIT(13));
+    TEST_ASSERT_TRUE(((lut.saturated[1] >> 14) & 1U) != 0U);
+}
+
+void test_array_lut_build_int8_should_saturate_to_int8(void)
+{
+    const lut_op_t ops[] = {{LUT_OP_SCALE, -2, 0}, {LUT_OP_CLAMP, -100, 100}};
+    array_lut_t lut;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_lut_build_int8(&lut, ops, ARRAY_SIZE(ops)));
+
+    TEST_ASSERT_EQUAL_INT8(-20, (int8_t) lut.table[10]);
+    TEST_ASSERT_EQUAL_INT8(100, (int8_t) lut.table[(uint8_t) -64]); // 128 -> 127 -> 100
+    TEST_ASSERT_EQUAL_INT8(-100, (int8_t) lut.table[60]);           // -120 -> -100
+    TEST_ASSERT_EQUAL_INT8(6, (int8_t) lut.table[(uint8_t) -3]);
+}
+
+void test_array_lut_build_should_reject_invalid_chain(void)
+{
+    const lut_op_t bad_clamp[] = {{LUT_OP_CLAMP, 10, 5}};
+    const lut_op_t bad_fixed[] = {{LUT_OP_SCALE_FIXED, 1, 0}};
+    array_lut_t lut;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_lut_build_uint8(NULL, bad_clamp, 1U));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_lut_build_uint8(&lut, NULL, 1U));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT, array_lut_build_uint8(&lut, bad_clamp, 1U));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT, array_lut_build_int8(&lut, bad_fixed, 1U));
+}
+
+void test_array_lut_build_should_saturate_out_of_range_clamp_bounds(void)
+{
+    const lut_op_t above_uint8[] = {{LUT_OP_CLAMP, 300, 400}};
+    const lut_op_t below_int8[] = {{LUT_OP_CLAMP, -500, -300}};
+    array_lut_t lut;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_lut_build_uint8(&lut, above_uint8, 1U));
+    TEST_ASSERT_EQUAL_UINT8(UINT8_MAX, lut.table[0]);
+    TEST_ASSERT_EQUAL_UINT8(UINT8_MAX, lut.table[255]);
+    TEST_ASSERT_EQUAL_HEX64(~(uint64_t) 0U, lut.saturated[3]);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_lut_build_int8(&lut, below_int8, 1U));
+    TEST_ASSERT_EQUAL_INT8(INT8_MIN, (int8_t) lut.table[0]);
+    TEST_ASSERT_EQUAL_INT8(INT8_MIN, (int8_t) lut.table[(uint8_t) INT8_MIN]);
+    TEST_ASSERT_EQUAL_HEX64(~(uint64_t) 0U, lut.saturated[2]);
+}
+
+// ----------- array_lut_apply tests -----------
+void test_array_lut_apply_should_transform_and_report_saturation(void)
+{
+    const lut_op_t ops[] = {{LUT_OP_SCALE_FIXED, 49152, 15}}; // x1.5
+    const uint8_t src[] = {10, 200, 100, 171};
+    uint8_t dst[4] = {0};
+    uint64_t mask[1] = {0};
+    size_t count = 0U;
+    array_lut_t lut;
+
+    array_lut_build_uint8(&lut, ops, ARRAY_SIZE(ops));
+    array_status_t status = array_lut_apply(&lut, src, dst, 4U, &count, mask);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_size_t(2U, count);
+    TEST_ASSERT_EQUAL_HEX64(0xAU, mask[0]);
+    TEST_ASSERT_EQUAL_UINT8(15U, dst[0]);
+    TEST_ASSERT_EQUAL_UINT8(255U, dst[1]);
+    TEST_ASSERT_EQUAL_UINT8(150U, dst[2]);
+}
+
+void test_array_lut_apply_int8_should_work_in_place(void)
+{
+    const lut_op_t ops[] = {{LUT_OP_OFFSET, -10, 0}};
+    int8_t data[] = {0, -120, 127};
+    array_lut_t lut;
+
+    array_lut_build_int8(&lut, ops, ARRAY_SIZE(ops));
+    array_status_t status = array_lut_apply_int8(&lut, data, data, 3U, NULL, NULL);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_INT8(-10, data[0]);
+    TEST_ASSERT_EQUAL_INT8(INT8_MIN, data[1]);
+    TEST_ASSERT_EQUAL_INT8(117, data[2]);
+}
+
+void test_array_lut_apply_should_return_error_on_invalid_input(void)
+{
+    array_lut_t lut;
+    uint8_t data[1] = {0};
+
+    array_lut_build_uint8(&lut, NULL, 0U);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_lut_apply(&lut, NULL, data, 1U, NULL, NULL));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_lut_apply(&lut, data, data, 0U, NULL, NULL));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- array_lut_build tests -----------
+    RUN_TEST(test_array_lut_build_uint8_should_match_sequential_kernels);
+    RUN_TEST(test_array_lut_build_int8_should_saturate_to_int8);
+    RUN_TEST(test_array_lut_build_should_reject_invalid_chain);
+    RUN_TEST(test_array_lut_build_should_saturate_out_of_range_clamp_bounds);
+
+    // ----------- array_lut_apply tests -----------
+    RUN_TEST(test_array_lut_apply_should_transform_and_report_saturation);
+    RUN_TEST(test_array_lut_apply_int8_should_work_in_place);
+    RUN_TEST(test_array_lut_apply_should_return_error_on_invalid_input);
+
+    return UNITY_END();
+}
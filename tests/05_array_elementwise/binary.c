@@ -0,0 +1,162 @@
+#include "array/array_elementwise.h"
+#include "unity.h"
+
+// ----------- array_binary_int32 tests -----------
+void test_array_binary_int32_should_add_out_of_place(void)
+{
+    const int32_t a[] = {1, -2, 100};
+    const int32_t b[] = {10, 20, -300};
+    int32_t dst[3] = {0};
+
+    array_status_t status = array_binary_int32(a, b, dst, 3, BINARY_OP_ADD, CLAMP_INT32);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT32(11, dst[0]);
+    TEST_ASSERT_EQUAL_INT32(18, dst[1]);
+    TEST_ASSERT_EQUAL_INT32(-200, dst[2]);
+}
+
+void test_array_binary_int32_should_saturate_in_place(void)
+{
+    int32_t a[] = {INT32_MAX, INT32_MIN, 70000, -70000};
+    const int32_t b[] = {2, 2, 1, 1};
+
+    array_status_t status = array_binary_int32(a, b, a, 4, BINARY_OP_MUL, CLAMP_INT32);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, a[0]);
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, a[1]);
+
+    status = array_binary_int32(a, b, a, 4, BINARY_OP_SUB, CLAMP_INT16);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_INT32(INT16_MAX, a[2]);
+    TEST_ASSERT_EQUAL_INT32(INT16_MIN, a[3]);
+}
+
+void test_array_binary_int32_should_compute_min_max_absdiff(void)
+{
+    const int32_t a[] = {5, -7, INT32_MIN};
+    const int32_t b[] = {3, 4, INT32_MAX};
+    int32_t dst[3] = {0};
+
+    array_binary_int32(a, b, dst, 3, BINARY_OP_MIN, CLAMP_INT32);
+    TEST_ASSERT_EQUAL_INT32(3, dst[0]);
+    TEST_ASSERT_EQUAL_INT32(-7, dst[1]);
+
+    array_binary_int32(a, b, dst, 3, BINARY_OP_MAX, CLAMP_INT32);
+    TEST_ASSERT_EQUAL_INT32(5, dst[0]);
+    TEST_ASSERT_EQUAL_INT32(4, dst[1]);
+
+    array_status_t status = array_binary_int32(a, b, dst, 3, BINARY_OP_ABSDIFF, CLAMP_INT32);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_INT32(2, dst[0]);
+    TEST_ASSERT_EQUAL_INT32(11, dst[1]);
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, dst[2]);
+}
+
+void test_array_binary_should_return_error_on_invalid_input(void)
+{
+    int32_t a[] = {1};
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL,
+                      array_binary_int32(a, NULL, a, 1, BINARY_OP_ADD, CLAMP_INT32));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY,
+                      array_binary_int32(a, a, a, 0, BINARY_OP_ADD, CLAMP_INT32));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_binary_int32(a, a, a, 1, (binary_op_t) 42, CLAMP_INT32));
+}
+
+// ----------- array_binary_uint32 tests -----------
+void test_array_binary_uint32_should_saturate_sub_and_mul(void)
+{
+    const uint32_t a[] = {5U, UINT32_MAX, 200U};
+    const uint32_t b[] = {7U, UINT32_MAX, 2U};
+    uint32_t dst[3] = {0};
+
+    array_status_t status = array_binary_uint32(a, b, dst, 3, BINARY_OP_SUB, CLAMP_UINT32);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_UINT32(0U, dst[0]);
+    TEST_ASSERT_EQUAL_UINT32(0U, dst[1]);
+    TEST_ASSERT_EQUAL_UINT32(198U, dst[2]);
+
+    status = array_binary_uint32(a, b, dst, 3, BINARY_OP_MUL, CLAMP_UINT32);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_UINT32(35U, dst[0]);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, dst[1]);
+    TEST_ASSERT_EQUAL_UINT32(400U, dst[2]);
+}
+
+// ----------- narrow kernels tests -----------
+void test_array_binary_int16_should_saturate_to_int16(void)
+{
+    const int16_t a[] = {30000, -30000, 5};
+    const int16_t b[] = {10000, 10000, 6};
+    int16_t dst[3] = {0};
+
+    array_status_t status = array_binary_int16(a, b, dst, 3, BINARY_OP_ADD);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_INT16(INT16_MAX, dst[0]);
+    TEST_ASSERT_EQUAL_INT16(-20000, dst[1]);
+    TEST_ASSERT_EQUAL_INT16(11, dst[2]);
+}
+
+void test_array_binary_uint16_should_compute_absdiff(void)
+{
+    const uint16_t a[] = {10U, 65535U};
+    const uint16_t b[] = {65535U, 0U};
+    uint16_t dst[2] = {0};
+
+    array_status_t status = array_binary_uint16(a, b, dst, 2, BINARY_OP_ABSDIFF);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_UINT16(65525U, dst[0]);
+    TEST_ASSERT_EQUAL_UINT16(65535U, dst[1]);
+}
+
+void test_array_binary_int8_should_saturate_mul(void)
+{
+    int8_t a[] = {-128, 12, -3};
+    const int8_t b[] = {-1, 11, 4};
+
+    array_status_t status = array_binary_int8(a, b, a, 3, BINARY_OP_MUL);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_INT8(INT8_MAX, a[0]);
+    TEST_ASSERT_EQUAL_INT8(127, a[1]);
+    TEST_ASSERT_EQUAL_INT8(-12, a[2]);
+}
+
+void test_array_binary_uint8_should_saturate_add_and_sub(void)
+{
+    const uint8_t a[] = {250U, 3U};
+    uint8_t b[] = {10U, 5U};
+
+    array_status_t status = array_binary_uint8(a, b, b, 2, BINARY_OP_ADD);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_UINT8(255U, b[0]);
+    TEST_ASSERT_EQUAL_UINT8(8U, b[1]);
+
+    status = array_binary_uint8(a, b, b, 2, BINARY_OP_SUB);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_UINT8(0U, b[0]);
+    TEST_ASSERT_EQUAL_UINT8(0U, b[1]);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- array_binary_int32 tests -----------
+    RUN_TEST(test_array_binary_int32_should_add_out_of_place);
+    RUN_TEST(test_array_binary_int32_should_saturate_in_place);
+    RUN_TEST(test_array_binary_int32_should_compute_min_max_absdiff);
+    RUN_TEST(test_array_binary_should_return_error_on_invalid_input);
+
+    // ----------- array_binary_uint32 tests -----------
+    RUN_TEST(test_array_binary_uint32_should_saturate_sub_and_mul);
+
+    // ----------- narrow kernels tests -----------
+    RUN_TEST(test_array_binary_int16_should_saturate_to_int16);
+    RUN_TEST(test_array_binary_uint16_should_compute_absdiff);
+    RUN_TEST(test_array_binary_int8_should_saturate_mul);
+    RUN_TEST(test_array_binary_uint8_should_saturate_add_and_sub);
+
+    return UNITY_END();
+}
@@ -0,0 +1,118 @@
+#include "array/array_dot.h"
+#include "unity.h"
+
+#define DOT_SIZE 1001U
+
+// Reference: plain scalar loop (inputs chosen so it cannot overflow)
+static int64_t reference_dot_i32(const int32_t* a, const int32_t* b, size_t size)
+{
+    int64_t sum = 0;
+    for (size_t i = 0U; i < size; ++i)
+    {
+        sum += (int64_t) a[i] * b[i];
+    }
+    return sum;
+}
+
+// ----------- array_dot_i32 tests -----------
+void test_array_dot_i32_should_match_reference(void)
+{
+    static int32_t a[DOT_SIZE];
+    static int32_t b[DOT_SIZE];
+    int64_t dot = 0;
+
+    for (size_t i = 0U; i < DOT_SIZE; ++i)
+    {
+        a[i] = (int32_t) (i * 7919U) - 400000;
+        b[i] = 3000 - (int32_t) (i * 13U);
+    }
+
+    array_status_t status = array_dot_i32(a, b, DOT_SIZE, &dot);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT64(reference_dot_i32(a, b, DOT_SIZE), dot);
+}
+
+void test_array_dot_i32_should_be_exact_near_int64_limits(void)
+{
+    // 2^62 + 2^62 overflows a naive int64 running sum; the final result still fits
+    const int32_t a[] = {INT32_MIN, INT32_MIN, INT32_MAX};
+    const int32_t b[] = {INT32_MIN, INT32_MIN, -INT32_MAX};
+    int64_t dot = 0;
+
+    array_status_t status = array_dot_i32(a, b, 3, &dot);
+    int64_t expected = ((int64_t) 1 << 62) + ((int64_t) 1 << 32) - 1;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT64(expected, dot);
+}
+
+void test_array_dot_i32_should_saturate_on_overflow(void)
+{
+    const int32_t a[] = {INT32_MIN, INT32_MIN, INT32_MIN};
+    int64_t dot = 0;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, array_dot_i32(a, a, 3, &dot));
+    TEST_ASSERT_EQUAL_INT64(INT64_MAX, dot);
+}
+
+void test_array_dot_should_return_error_on_invalid_input(void)
+{
+    const int32_t a[] = {1};
+    int64_t dot = 0;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_dot_i32(a, NULL, 1, &dot));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_dot_i32(a, a, 1, NULL));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_dot_i32(a, a, 0, &dot));
+}
+
+// ----------- array_dot_i16 tests -----------
+void test_array_dot_i16_should_handle_extreme_pairs(void)
+{
+    const int16_t a[] = {INT16_MIN, INT16_MIN, INT16_MIN, 3, 5};
+    const int16_t b[] = {INT16_MIN, INT16_MIN, INT16_MIN, -4, 6};
+    int64_t dot = 0;
+
+    array_status_t status = array_dot_i16(a, b, 5, &dot);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT64(3LL * (1LL << 30) - 12 + 30, dot);
+}
+
+// ----------- array_dot_u8i8 tests -----------
+void test_array_dot_u8i8_should_span_multiple_blocks(void)
+{
+    static uint8_t a[DOT_U8I8_BLOCK + 5U];
+    static int8_t b[DOT_U8I8_BLOCK + 5U];
+    int64_t dot = 0;
+
+    for (size_t i = 0U; i < DOT_U8I8_BLOCK + 5U; ++i)
+    {
+        a[i] = 255U;
+        b[i] = INT8_MIN;
+    }
+
+    array_status_t status = array_dot_u8i8(a, b, DOT_U8I8_BLOCK + 5U, &dot);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT64(-255LL * 128LL * (int64_t) (DOT_U8I8_BLOCK + 5U), dot);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- array_dot_i32 tests -----------
+    RUN_TEST(test_array_dot_i32_should_match_reference);
+    RUN_TEST(test_array_dot_i32_should_be_exact_near_int64_limits);
+    RUN_TEST(test_array_dot_i32_should_saturate_on_overflow);
+    RUN_TEST(test_array_dot_should_return_error_on_invalid_input);
+
+    // ----------- array_dot_i16 tests -----------
+    RUN_TEST(test_array_dot_i16_should_handle_extreme_pairs);
+
+    // ----------- array_dot_u8i8 tests -----------
+    RUN_TEST(test_array_dot_u8i8_should_span_multiple_blocks);
+
+    return UNITY_END();
+}
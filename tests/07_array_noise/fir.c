@@ -0,0 +1,155 @@
+#include "array/array_noise.h"
+#include "unity.h"
+
+#define FIR_TEST_SIZE 301U
+
+static int32_t signal[FIR_TEST_SIZE];
+static int32_t expected[FIR_TEST_SIZE];
+static int32_t actual[FIR_TEST_SIZE];
+static array_fir_t fir;
+
+// Reference: naive double loop over the whole signal, zero initial history, Q15 rounding
+static void reference_fir(const int16_t* taps, size_t tap_count, const int32_t* in, int32_t* out,
+                          size_t size)
+{
+    for (size_t n = 0U; n < size; ++n)
+    {
+        int64_t acc = 0;
+        for (size_t k = 0U; k < tap_count && k <= n; ++k)
+        {
+            acc += (int64_t) taps[k] * in[n - k];
+        }
+        acc = (acc + (1 << 14)) >> 15;
+        out[n] = (int32_t) acc;
+    }
+}
+
+void setUp(void)
+{
+    for (size_t i = 0U; i < FIR_TEST_SIZE; ++i)
+    {
+        signal[i] = (int32_t) ((i * 7919U) % 20001U) - 10000;
+    }
+}
+
+void tearDown(void)
+{
+}
+
+// ----------- array_fir_process tests -----------
+void test_array_fir_process_symmetric_should_match_reference(void)
+{
+    const int16_t taps[] = {1000, 3000, 8000, 12000, 8000, 3000, 1000};
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_fir_init(&fir, taps, 7U, 15U));
+    TEST_ASSERT_TRUE(fir.symmetric);
+
+    reference_fir(taps, 7U, signal, expected, FIR_TEST_SIZE);
+    array_status_t status = array_fir_process(&fir, signal, actual, FIR_TEST_SIZE, CLAMP_INT32);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected, actual, FIR_TEST_SIZE);
+}
+
+void test_array_fir_process_asymmetric_should_match_reference(void)
+{
+    const int16_t taps[] = {-2000, 5000, 16000, 9000, 4000, -1000};
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_fir_init(&fir, taps, 6U, 15U));
+    TEST_ASSERT_FALSE(fir.symmetric);
+
+    reference_fir(taps, 6U, signal, expected, FIR_TEST_SIZE);
+    array_fir_process(&fir, signal, actual, FIR_TEST_SIZE, CLAMP_INT32);
+
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected, actual, FIR_TEST_SIZE);
+}
+
+void test_array_fir_process_should_stream_in_chunks(void)
+{
+    const int16_t taps[] = {2000, 4000, 6000, 8000, 6000, 4000, 2000, 500, 500, 100, 100};
+    const size_t chunks[] = {1U, 3U, 17U, 2U, 64U, 5U, 209U};
+
+    array_fir_init(&fir, taps, 11U, 15U);
+    reference_fir(taps, 11U, signal, expected, FIR_TEST_SIZE);
+
+    size_t pos = 0U;
+    for (size_t c = 0U; c < sizeof(chunks) / sizeof(chunks[0]); ++c)
+    {
+        array_fir_process(&fir, &signal[pos], &actual[pos], chunks[c], CLAMP_INT32);
+        pos += chunks[c];
+    }
+
+    TEST_ASSERT_EQUAL_size_t(FIR_TEST_SIZE, pos);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected, actual, FIR_TEST_SIZE);
+}
+
+void test_array_fir_process_should_saturate_output(void)
+{
+    const int16_t taps[] = {INT16_MAX, INT16_MAX};
+    const int32_t in[] = {100, 100, -100};
+    int32_t out[3] = {0};
+
+    array_fir_init(&fir, taps, 2U, 15U);
+    array_status_t status = array_fir_process(&fir, in, out, 3U, CLAMP_INT8);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_INT32(100, out[0]);
+    TEST_ASSERT_EQUAL_INT32(INT8_MAX, out[1]);
+    TEST_ASSERT_EQUAL_INT32(0, out[2]);
+}
+
+void test_array_fir_should_return_error_on_invalid_input(void)
+{
+    const int16_t taps[] = {1};
+    int32_t buf[1] = {0};
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_fir_init(&fir, NULL, 1U, 15U));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_fir_init(&fir, taps, 0U, 15U));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_fir_init(&fir, taps, FIR_MAX_TAPS + 1U, 15U));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT, array_fir_init(&fir, taps, 1U, 16U));
+
+    array_fir_init(&fir, taps, 1U, 0U);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_fir_process(&fir, NULL, buf, 1U, CLAMP_INT32));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_fir_process(&fir, buf, buf, 0U, CLAMP_INT32));
+}
+
+// ----------- array_fir_process_i16 tests -----------
+void test_array_fir_process_i16_should_match_int32_path(void)
+{
+    static int16_t in16[FIR_TEST_SIZE * 2U];
+    static int16_t out16[FIR_TEST_SIZE * 2U];
+    const int16_t taps[] = {8192, 16384, 8192};
+
+    for (size_t i = 0U; i < FIR_TEST_SIZE * 2U; ++i)
+    {
+        in16[i] = (int16_t) (((i * 7919U) % 60001U) - 30000U);
+    }
+
+    array_fir_init(&fir, taps, 3U, 15U);
+    array_status_t status = array_fir_process_i16(&fir, in16, out16, FIR_TEST_SIZE * 2U);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    for (size_t n = 2U; n < FIR_TEST_SIZE * 2U; ++n)
+    {
+        int32_t sum = 8192 * in16[n] + 16384 * in16[n - 1U] + 8192 * in16[n - 2U];
+        TEST_ASSERT_EQUAL_INT16((int16_t) ((sum + (1 << 14)) >> 15), out16[n]);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- array_fir_process tests -----------
+    RUN_TEST(test_array_fir_process_symmetric_should_match_reference);
+    RUN_TEST(test_array_fir_process_asymmetric_should_match_reference);
+    RUN_TEST(test_array_fir_process_should_stream_in_chunks);
+    RUN_TEST(test_array_fir_process_should_saturate_output);
+    RUN_TEST(test_array_fir_should_return_error_on_invalid_input);
+
+    // ----------- array_fir_process_i16 tests -----------
+    RUN_TEST(test_array_fir_process_i16_should_match_int32_path);
+
+    return UNITY_END();
+}
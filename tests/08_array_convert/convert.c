@@ -0,0 +1,122 @@
+#include "array/array_convert.h"
+#include "unity.h"
+
+// ----------- narrowing tests -----------
+void test_array_pack_i32_to_i16_should_saturate_both_ends(void)
+{
+    const int32_t src[] = {INT32_MIN, -32769, -32768, 0, 32767, 32768, INT32_MAX};
+    const int16_t expected[] = {INT16_MIN, INT16_MIN, INT16_MIN, 0, INT16_MAX, INT16_MAX,
+                                INT16_MAX};
+    int16_t dst[7];
+
+    array_status_t status = array_pack_i32_to_i16(src, dst, 7);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_INT16_ARRAY(expected, dst, 7);
+}
+
+void test_array_pack_i16_to_i8_should_return_ok_when_in_range(void)
+{
+    const int16_t src[] = {-128, -1, 0, 1, 127};
+    const int8_t expected[] = {-128, -1, 0, 1, 127};
+    int8_t dst[5];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_pack_i16_to_i8(src, dst, 5));
+    TEST_ASSERT_EQUAL_INT8_ARRAY(expected, dst, 5);
+}
+
+void test_array_pack_i16_to_u8_should_clamp_negatives_to_zero(void)
+{
+    const int16_t src[] = {-300, -1, 0, 200, 255, 256};
+    const uint8_t expected[] = {0, 0, 0, 200, 255, 255};
+    uint8_t dst[6];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, array_pack_i16_to_u8(src, dst, 6));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, dst, 6);
+}
+
+void test_array_pack_u32_to_u8_should_saturate_high_values(void)
+{
+    const uint32_t src[] = {0U, 255U, 256U, UINT32_MAX};
+    const uint8_t expected[] = {0U, 255U, 255U, 255U};
+    uint8_t dst[4];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, array_pack_u32_to_u8(src, dst, 4));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, dst, 4);
+}
+
+void test_array_pack_should_return_error_on_invalid_input(void)
+{
+    const int32_t src[] = {1};
+    int16_t dst[1];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_pack_i32_to_i16(NULL, dst, 1));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_pack_i32_to_i16(src, NULL, 1));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_pack_i32_to_i16(src, dst, 0));
+}
+
+// ----------- signed <-> unsigned tests -----------
+void test_array_convert_i32_to_u32_should_clamp_negatives(void)
+{
+    const int32_t src[] = {INT32_MIN, -1, 0, INT32_MAX};
+    const uint32_t expected[] = {0U, 0U, 0U, (uint32_t) INT32_MAX};
+    uint32_t dst[4];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, array_convert_i32_to_u32(src, dst, 4));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected, dst, 4);
+}
+
+void test_array_convert_u32_to_i32_should_saturate_above_int32_max(void)
+{
+    const uint32_t src[] = {0U, (uint32_t) INT32_MAX, (uint32_t) INT32_MAX + 1U, UINT32_MAX};
+    const int32_t expected[] = {0, INT32_MAX, INT32_MAX, INT32_MAX};
+    int32_t dst[4];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, array_convert_u32_to_i32(src, dst, 4));
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected, dst, 4);
+}
+
+// ----------- widening tests -----------
+void test_array_unpack_should_round_trip_with_pack(void)
+{
+    const int8_t src[] = {INT8_MIN, -5, 0, 5, INT8_MAX};
+    int32_t wide[5];
+    int8_t back[5];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_unpack_i8_to_i32(src, wide, 5));
+    TEST_ASSERT_EQUAL_INT32(INT8_MIN, wide[0]);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_pack_i32_to_i8(wide, back, 5));
+    TEST_ASSERT_EQUAL_INT8_ARRAY(src, back, 5);
+}
+
+void test_array_unpack_u8_to_u32_should_zero_extend(void)
+{
+    const uint8_t src[] = {0U, 128U, 255U};
+    const uint32_t expected[] = {0U, 128U, 255U};
+    uint32_t dst[3];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_unpack_u8_to_u32(src, dst, 3));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected, dst, 3);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- narrowing tests -----------
+    RUN_TEST(test_array_pack_i32_to_i16_should_saturate_both_ends);
+    RUN_TEST(test_array_pack_i16_to_i8_should_return_ok_when_in_range);
+    RUN_TEST(test_array_pack_i16_to_u8_should_clamp_negatives_to_zero);
+    RUN_TEST(test_array_pack_u32_to_u8_should_saturate_high_values);
+    RUN_TEST(test_array_pack_should_return_error_on_invalid_input);
+
+    // ----------- signed <-> unsigned tests -----------
+    RUN_TEST(test_array_convert_i32_to_u32_should_clamp_negatives);
+    RUN_TEST(test_array_convert_u32_to_i32_should_saturate_above_int32_max);
+
+    // ----------- widening tests -----------
+    RUN_TEST(test_array_unpack_should_round_trip_with_pack);
+    RUN_TEST(test_array_unpack_u8_to_u32_should_zero_extend);
+
+    return UNITY_END();
+}
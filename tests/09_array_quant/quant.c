@@ -0,0 +1,224 @@
+#include "array/array_quant.h"
+#include "unity.h"
+
+// ----------- array_quantize_int8 tests -----------
+void test_array_quantize_int8_should_round_half_to_even(void)
+{
+    const float src[] = {0.5f, 1.5f, 2.5f, -0.5f, -1.5f, 2.4f, 2.6f};
+    const int8_t expected[] = {0, 2, 2, 0, -2, 2, 3};
+    const quant_params_t params = {1.0f, 0};
+    int8_t dst[7];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_quantize_int8(src, dst, 7, params));
+    TEST_ASSERT_EQUAL_INT8_ARRAY(expected, dst, 7);
+}
+
+void test_array_quantize_int8_should_round_before_adding_odd_zero_point(void)
+{
+    const float src[] = {0.5f, 2.5f, -0.5f, -1.5f, 3.5f};
+    const int8_t expected[] = {1, 3, 1, -1, 5};
+    const quant_params_t params = {1.0f, 1};
+    int8_t dst[5];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_quantize_int8(src, dst, 5, params));
+    TEST_ASSERT_EQUAL_INT8_ARRAY(expected, dst, 5);
+}
+
+void test_array_quantize_int8_should_divide_by_non_power_of_two_scale(void)
+{
+    // x * (1 / scale) rounds these to the next integer away from zero; x / scale does not
+    const float src[] = {-11.15f, -10.15f, -9.15f, -5.95f, 11.15f, 9.15f};
+    const int8_t expected[] = {-111, -101, -91, -59, 111, 91};
+    const quant_params_t params = {0.1f, 0};
+    int8_t dst[6];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_quantize_int8(src, dst, 6, params));
+    TEST_ASSERT_EQUAL_INT8_ARRAY(expected, dst, 6);
+}
+
+void test_array_quantize_int8_should_saturate_and_apply_zero_point(void)
+{
+    const float src[] = {-1000.0f, -1.0f, 0.0f, 1.0f, 1000.0f};
+    const int8_t expected[] = {INT8_MIN, 6, 10, 14, INT8_MAX};
+    const quant_params_t params = {0.25f, 10};
+    int8_t dst[5];
+
+    array_status_t status = array_quantize_int8(src, dst, 5, params);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_INT8_ARRAY(expected, dst, 5);
+}
+
+void test_array_quantize_int8_should_only_flag_values_rounding_outside_range(void)
+{
+    const float in_range[] = {127.3f, -128.4f, -128.5f};
+    const int8_t expected[] = {INT8_MAX, INT8_MIN, INT8_MIN};
+    const float above[] = {127.6f};
+    const quant_params_t params = {1.0f, 0};
+    int8_t dst[3];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_quantize_int8(in_range, dst, 3, params));
+    TEST_ASSERT_EQUAL_INT8_ARRAY(expected, dst, 3);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP,
+                      array_quantize_int8(above, dst, 1, params));
+    TEST_ASSERT_EQUAL_INT8(INT8_MAX, dst[0]);
+}
+
+void test_array_quantize_uint8_should_flag_values_far_below_range(void)
+{
+    const float in_range[] = {-0.5f, 255.4f};
+    const uint8_t expected_in_range[] = {0, UINT8_MAX};
+    const float below[] = {-0.6f, -200.0f};
+    const uint8_t expected_below[] = {0, 0};
+    const quant_params_t params = {1.0f, 0};
+    uint8_t dst[2];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_quantize_uint8(in_range, dst, 2, params));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_in_range, dst, 2);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP,
+                      array_quantize_uint8(below, dst, 2, params));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_below, dst, 2);
+}
+
+void test_array_quantize_should_return_error_on_invalid_input(void)
+{
+    const float src[] = {1.0f};
+    int8_t dst[1];
+    uint8_t udst[1];
+    const quant_params_t zero_scale = {0.0f, 0};
+    const quant_params_t bad_zero_point = {1.0f, -1};
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_quantize_int8(NULL, dst, 1, zero_scale));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_quantize_int8(src, dst, 0, zero_scale));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_quantize_int8(src, dst, 1, zero_scale));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_quantize_uint8(src, udst, 1, bad_zero_point));
+}
+
+// ----------- array_dequantize tests -----------
+void test_array_dequantize_uint8_should_invert_quantize(void)
+{
+    const float src[] = {-2.0f, -0.5f, 0.0f, 0.75f, 3.0f};
+    const quant_params_t params = {0.25f, 128};
+    uint8_t q[5];
+    float back[5];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_quantize_uint8(src, q, 5, params));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_dequantize_uint8(q, back, 5, params));
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(src, back, 5);
+}
+
+// ----------- per-channel tests -----------
+void test_array_quantize_int8_per_channel_should_use_channel_params(void)
+{
+    const float src[] = {1.0f, 1.0f, -2.0f, -2.0f, 0.0f, 0.0f};
+    const quant_params_t params[] = {{0.5f, 0}, {0.1f, 5}};
+    const int8_t expected[] = {2, 15, -4, -15, 0, 5};
+    int8_t dst[6];
+
+    array_status_t status = array_quantize_int8_per_channel(src, dst, 6, params, 2);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT8_ARRAY(expected, dst, 6);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_quantize_int8_per_channel(src, dst, 5, params, 2));
+}
+
+void test_array_quantize_uint8_per_channel_should_cover_many_channels(void)
+{
+    enum
+    {
+        CHANNELS = 70,
+        FRAMES = 3
+    };
+    quant_params_t params[CHANNELS];
+    float src[CHANNELS * FRAMES];
+    uint8_t dst[CHANNELS * FRAMES];
+
+    for (size_t c = 0U; c < CHANNELS; ++c)
+    {
+        params[c].scale = 1.0f / (float) (c + 1U);
+        params[c].zero_point = (int32_t) c;
+    }
+
+    for (size_t i = 0U; i < CHANNELS * FRAMES; ++i)
+    {
+        src[i] = (float) (i / CHANNELS);
+    }
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                      array_quantize_uint8_per_channel(src, dst, CHANNELS * FRAMES, params,
+                                                       CHANNELS));
+
+    for (size_t i = 0U; i < CHANNELS * FRAMES; ++i)
+    {
+        size_t c = i % CHANNELS;
+        TEST_ASSERT_EQUAL_UINT8((i / CHANNELS) * (c + 1U) + c, dst[i]);
+    }
+}
+
+// ----------- array_quant_calibrate tests -----------
+void test_array_quant_calibrate_should_map_range_to_uint8(void)
+{
+    const float src[] = {-1.0f, 0.5f, 3.0f, 2.0f};
+    quant_params_t params;
+    uint8_t q[4];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_quant_calibrate(src, 4, 0, UINT8_MAX, &params));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 4.0f / 255.0f, params.scale);
+    TEST_ASSERT_EQUAL_INT32(64, params.zero_point);
+
+    // The rounded zero point may push the top value a fraction of a step past 255
+    array_quantize_uint8(src, q, 4, params);
+    TEST_ASSERT_EQUAL_UINT8(0U, q[0]);
+    TEST_ASSERT_EQUAL_UINT8(UINT8_MAX, q[2]);
+}
+
+void test_array_quant_calibrate_should_include_zero(void)
+{
+    const float src[] = {2.0f, 4.0f};
+    quant_params_t params;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_quant_calibrate(src, 2, INT8_MIN, INT8_MAX, &params));
+    TEST_ASSERT_EQUAL_INT32(INT8_MIN, params.zero_point);
+}
+
+void test_array_quant_calibrate_should_reject_non_finite_input(void)
+{
+    const float src[] = {1.0f, 0.0f / 0.0f};
+    quant_params_t params;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_quant_calibrate(src, 2, 0, UINT8_MAX, &params));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- array_quantize_int8 tests -----------
+    RUN_TEST(test_array_quantize_int8_should_round_half_to_even);
+    RUN_TEST(test_array_quantize_int8_should_round_before_adding_odd_zero_point);
+    RUN_TEST(test_array_quantize_int8_should_divide_by_non_power_of_two_scale);
+    RUN_TEST(test_array_quantize_int8_should_saturate_and_apply_zero_point);
+    RUN_TEST(test_array_quantize_int8_should_only_flag_values_rounding_outside_range);
+    RUN_TEST(test_array_quantize_uint8_should_flag_values_far_below_range);
+    RUN_TEST(test_array_quantize_should_return_error_on_invalid_input);
+
+    // ----------- array_dequantize tests -----------
+    RUN_TEST(test_array_dequantize_uint8_should_invert_quantize);
+
+    // ----------- per-channel tests -----------
+    RUN_TEST(test_array_quantize_int8_per_channel_should_use_channel_params);
+    RUN_TEST(test_array_quantize_uint8_per_channel_should_cover_many_channels);
+
+    // ----------- array_quant_calibrate tests -----------
+    RUN_TEST(test_array_quant_calibrate_should_map_range_to_uint8);
+    RUN_TEST(test_array_quant_calibrate_should_include_zero);
+    RUN_TEST(test_array_quant_calibrate_should_reject_non_finite_input);
+
+    return UNITY_END();
+}
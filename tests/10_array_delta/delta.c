@@ -0,0 +1,156 @@
+#include "array/array_delta.h"
+#include "unity.h"
+
+#define DELTA_SIZE 257U
+
+static int32_t signal[DELTA_SIZE];
+static int32_t encoded[DELTA_SIZE];
+static int32_t decoded[DELTA_SIZE];
+
+void setUp(void)
+{
+    for (size_t i = 0U; i < DELTA_SIZE; ++i)
+    {
+        signal[i] = 1000 + (int32_t) (i * 3U) - (int32_t) ((i * 7919U) % 5U);
+    }
+}
+
+void tearDown(void)
+{
+}
+
+// ----------- array_delta tests -----------
+void test_array_delta_encode_should_store_differences(void)
+{
+    const int32_t src[] = {10, 12, 11, 11, 15};
+    const int32_t expected[] = {10, 2, -1, 0, 4};
+    int32_t dst[5];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_delta_encode(src, dst, 5, 0));
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected, dst, 5);
+}
+
+void test_array_delta_should_round_trip_extreme_values(void)
+{
+    const int32_t src[] = {INT32_MAX, INT32_MIN, INT32_MAX, 0, INT32_MIN};
+    int32_t buf[5];
+
+    array_delta_encode(src, buf, 5, 0);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_delta_decode(buf, buf, 5, 0));
+    TEST_ASSERT_EQUAL_INT32_ARRAY(src, buf, 5);
+}
+
+void test_array_delta_should_work_in_place_and_in_chunks(void)
+{
+    int32_t buf[DELTA_SIZE];
+    for (size_t i = 0U; i < DELTA_SIZE; ++i)
+    {
+        buf[i] = signal[i];
+    }
+
+    // Encode in place in two chunks, chaining through the last value of the first chunk
+    array_delta_encode(buf, buf, 100U, 0);
+    array_delta_encode(&buf[100], &buf[100], DELTA_SIZE - 100U, signal[99]);
+
+    array_delta_decode(buf, decoded, 100U, 0);
+    array_delta_decode(&buf[100], &decoded[100], DELTA_SIZE - 100U, decoded[99]);
+
+    TEST_ASSERT_EQUAL_INT32_ARRAY(signal, decoded, DELTA_SIZE);
+}
+
+void test_array_delta_decode_stats_should_match_decoded_values(void)
+{
+    int32_t min = 0;
+    int32_t max = 0;
+    int64_t sum = 0;
+    int32_t expected_min = INT32_MAX;
+    int32_t expected_max = INT32_MIN;
+    int64_t expected_sum = 0;
+
+    for (size_t i = 0U; i < DELTA_SIZE; ++i)
+    {
+        expected_min = (signal[i] < expected_min) ? signal[i] : expected_min;
+        expected_max = (signal[i] > expected_max) ? signal[i] : expected_max;
+        expected_sum += signal[i];
+    }
+
+    array_delta_encode(signal, encoded, DELTA_SIZE, 0);
+    array_status_t status =
+        array_delta_decode_stats(encoded, decoded, DELTA_SIZE, 0, &min, &max, &sum);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, status);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(signal, decoded, DELTA_SIZE);
+    TEST_ASSERT_EQUAL_INT32(expected_min, min);
+    TEST_ASSERT_EQUAL_INT32(expected_max, max);
+    TEST_ASSERT_EQUAL_INT64(expected_sum, sum);
+}
+
+void test_array_delta_should_return_error_on_invalid_input(void)
+{
+    int32_t buf[1] = {0};
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_delta_encode(NULL, buf, 1, 0));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_delta_decode(buf, NULL, 1, 0));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_delta_decode(buf, buf, 0, 0));
+}
+
+// ----------- array_delta2 tests -----------
+void test_array_delta2_should_encode_constant_slope_to_zero(void)
+{
+    const int32_t src[] = {100, 110, 120, 130, 140};
+    const int32_t expected[] = {100, -90, 0, 0, 0};
+    int32_t dst[5];
+
+    array_delta2_encode(src, dst, 5, 0, 0);
+
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected, dst, 5);
+}
+
+void test_array_delta2_should_round_trip(void)
+{
+    array_delta2_encode(signal, encoded, DELTA_SIZE, 7, -3);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_delta2_decode(encoded, decoded, DELTA_SIZE, 7, -3));
+    TEST_ASSERT_EQUAL_INT32_ARRAY(signal, decoded, DELTA_SIZE);
+}
+
+// ----------- array_zigzag_delta tests -----------
+void test_array_zigzag_delta_encode_should_interleave_signs(void)
+{
+    const int32_t src[] = {0, -1, 0, 2, 0, INT32_MIN};
+    const uint32_t expected[] = {0U, 1U, 2U, 4U, 3U, UINT32_MAX};
+    uint32_t dst[6];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_zigzag_delta_encode(src, dst, 6, 0));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected, dst, 6);
+}
+
+void test_array_zigzag_delta_should_round_trip(void)
+{
+    static uint32_t codes[DELTA_SIZE];
+
+    array_zigzag_delta_encode(signal, codes, DELTA_SIZE, 0);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_zigzag_delta_decode(codes, decoded, DELTA_SIZE, 0));
+    TEST_ASSERT_EQUAL_INT32_ARRAY(signal, decoded, DELTA_SIZE);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- array_delta tests -----------
+    RUN_TEST(test_array_delta_encode_should_store_differences);
+    RUN_TEST(test_array_delta_should_round_trip_extreme_values);
+    RUN_TEST(test_array_delta_should_work_in_place_and_in_chunks);
+    RUN_TEST(test_array_delta_decode_stats_should_match_decoded_values);
+    RUN_TEST(test_array_delta_should_return_error_on_invalid_input);
+
+    // ----------- array_delta2 tests -----------
+    RUN_TEST(test_array_delta2_should_encode_constant_slope_to_zero);
+    RUN_TEST(test_array_delta2_should_round_trip);
+
+    // ----------- array_zigzag_delta tests -----------
+    RUN_TEST(test_array_zigzag_delta_encode_should_interleave_signs);
+    RUN_TEST(test_array_zigzag_delta_should_round_trip);
+
+    return UNITY_END();
+}
@@ -0,0 +1,178 @@
+#include "array/array_lazy.h"
+#include "unity.h"
+
+#define LAZY_SIZE 200U
+#define LAZY_LARGE_SIZE (1U << 20)
+
+static int32_t lazy_data[LAZY_SIZE];
+static int32_t large_data[LAZY_LARGE_SIZE];
+static int32_t reference[LAZY_SIZE];
+static array_lazy_t lazy;
+
+void setUp(void)
+{
+    for (size_t i = 0U; i < LAZY_SIZE; ++i)
+    {
+        lazy_data[i] = (int32_t) ((i * 7919U) % 101U) - 50;
+        reference[i] = lazy_data[i];
+    }
+}
+
+void tearDown(void)
+{
+}
+
+// Checks the O(1) stats against the reference array, then the materialized data
+static void assert_matches_reference(void)
+{
+    int32_t min = INT32_MAX;
+    int32_t max = INT32_MIN;
+    int64_t sum = 0;
+    for (size_t i = 0U; i < LAZY_SIZE; ++i)
+    {
+        min = (reference[i] < min) ? reference[i] : min;
+        max = (reference[i] > max) ? reference[i] : max;
+        sum += reference[i];
+    }
+
+    int32_t lazy_min = 0;
+    int32_t lazy_max = 0;
+    int64_t lazy_sum = 0;
+    array_lazy_min(&lazy, &lazy_min);
+    array_lazy_max(&lazy, &lazy_max);
+    array_lazy_sum(&lazy, &lazy_sum);
+
+    TEST_ASSERT_EQUAL_INT32(min, lazy_min);
+    TEST_ASSERT_EQUAL_INT32(max, lazy_max);
+    TEST_ASSERT_EQUAL_INT64(sum, lazy_sum);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_lazy_materialize(&lazy));
+    TEST_ASSERT_FALSE(array_lazy_pending(&lazy));
+    TEST_ASSERT_EQUAL_INT32_ARRAY(reference, lazy_data, LAZY_SIZE);
+}
+
+// ----------- deferred operation tests -----------
+void test_array_lazy_should_defer_non_saturating_operations(void)
+{
+    array_lazy_init(&lazy, lazy_data, LAZY_SIZE, CLAMP_INT16);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_lazy_offset(&lazy, 100));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_lazy_scale(&lazy, -3));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_lazy_offset(&lazy, -7));
+
+    // Memory is untouched until read
+    TEST_ASSERT_TRUE(array_lazy_pending(&lazy));
+    TEST_ASSERT_EQUAL_INT32(reference[0], lazy_data[0]);
+
+    array_offset(reference, LAZY_SIZE, 100, CLAMP_INT16);
+    array_scale(reference, LAZY_SIZE, -3, CLAMP_INT16);
+    array_offset(reference, LAZY_SIZE, -7, CLAMP_INT16);
+
+    assert_matches_reference();
+}
+
+void test_array_lazy_should_materialize_when_saturation_would_occur(void)
+{
+    array_lazy_init(&lazy, lazy_data, LAZY_SIZE, CLAMP_INT8);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_lazy_scale(&lazy, 2));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, array_lazy_offset(&lazy, 40));
+    TEST_ASSERT_FALSE(array_lazy_pending(&lazy));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, array_lazy_scale(&lazy, -2));
+
+    array_scale(reference, LAZY_SIZE, 2, CLAMP_INT8);
+    array_offset(reference, LAZY_SIZE, 40, CLAMP_INT8);
+    array_scale(reference, LAZY_SIZE, -2, CLAMP_INT8);
+
+    assert_matches_reference();
+}
+
+void test_array_lazy_should_match_sequential_calls_over_long_chains(void)
+{
+    const int32_t offsets[] = {1000, -2500, 0, 77, -1, 30000, -30000};
+    const int32_t factors[] = {3, -1, 1, 0, 2, -5, 7};
+
+    array_lazy_init(&lazy, lazy_data, LAZY_SIZE, CLAMP_INT16);
+
+    for (size_t k = 0U; k < 7U; ++k)
+    {
+        TEST_ASSERT_EQUAL(array_offset(reference, LAZY_SIZE, offsets[k], CLAMP_INT16),
+                          array_lazy_offset(&lazy, offsets[k]));
+        TEST_ASSERT_EQUAL(array_scale(reference, LAZY_SIZE, factors[k], CLAMP_INT16),
+                          array_lazy_scale(&lazy, factors[k]));
+    }
+
+    assert_matches_reference();
+}
+
+void test_array_lazy_should_bound_multiplier_growth(void)
+{
+    // All zeros never saturate, so only the multiplier limit forces a flush
+    for (size_t i = 0U; i < LAZY_SIZE; ++i)
+    {
+        lazy_data[i] = 0;
+        reference[i] = 0;
+    }
+
+    array_lazy_init(&lazy, lazy_data, LAZY_SIZE, CLAMP_INT32);
+    for (size_t k = 0U; k < 10U; ++k)
+    {
+        TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_lazy_scale(&lazy, 1 << 20));
+    }
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_lazy_offset(&lazy, -5));
+
+    array_offset(reference, LAZY_SIZE, -5, CLAMP_INT32);
+    assert_matches_reference();
+}
+
+void test_array_lazy_sum_should_not_materialize_large_offset_only_array(void)
+{
+    // Stored sum of about 5.2e9 is above the old worst-case bound of INT64_MAX / 2 / INT32_MAX
+    for (size_t i = 0U; i < LAZY_LARGE_SIZE; ++i)
+    {
+        large_data[i] = 5000;
+    }
+
+    int64_t sum = 0;
+    array_lazy_init(&lazy, large_data, LAZY_LARGE_SIZE, CLAMP_INT32);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_lazy_offset(&lazy, 100));
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_lazy_sum(&lazy, &sum));
+    TEST_ASSERT_EQUAL_INT64((int64_t) 5100 * LAZY_LARGE_SIZE, sum);
+    TEST_ASSERT_TRUE(array_lazy_pending(&lazy));
+    TEST_ASSERT_EQUAL_INT32(5000, large_data[LAZY_LARGE_SIZE - 1U]);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_lazy_scale(&lazy, -3));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_lazy_sum(&lazy, &sum));
+    TEST_ASSERT_EQUAL_INT64((int64_t) -15300 * LAZY_LARGE_SIZE, sum);
+    TEST_ASSERT_TRUE(array_lazy_pending(&lazy));
+}
+
+// ----------- setup tests -----------
+void test_array_lazy_should_return_error_on_invalid_input(void)
+{
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_lazy_init(&lazy, NULL, 1, CLAMP_INT32));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_lazy_init(&lazy, lazy_data, 0, CLAMP_INT32));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_lazy_offset(NULL, 1));
+
+    array_lazy_init(&lazy, lazy_data, LAZY_SIZE, CLAMP_INT32);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OFFSET_IS_ZERO, array_lazy_offset(&lazy, 0));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_lazy_sum(&lazy, NULL));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- deferred operation tests -----------
+    RUN_TEST(test_array_lazy_should_defer_non_saturating_operations);
+    RUN_TEST(test_array_lazy_should_materialize_when_saturation_would_occur);
+    RUN_TEST(test_array_lazy_should_match_sequential_calls_over_long_chains);
+    RUN_TEST(test_array_lazy_should_bound_multiplier_growth);
+    RUN_TEST(test_array_lazy_sum_should_not_materialize_large_offset_only_array);
+
+    // ----------- setup tests -----------
+    RUN_TEST(test_array_lazy_should_return_error_on_invalid_input);
+
+    return UNITY_END();
+}
@@ -0,0 +1,190 @@
+#include "array/array_stats.h"
+#include "array/array_view.h"
+#include "unity.h"
+
+#include <string.h>
+
+#define VIEW_TEST_SIZE (3U * VIEW_TILE + 17U)
+
+static int32_t source[VIEW_TEST_SIZE];
+static int32_t expected[VIEW_TEST_SIZE];
+static int32_t actual[VIEW_TEST_SIZE];
+static array_view_t view;
+
+void setUp(void)
+{
+    for (size_t i = 0U; i < VIEW_TEST_SIZE; ++i)
+    {
+        source[i] = (int32_t) ((i * 7919U) % 2001U) - 1000;
+        expected[i] = source[i];
+    }
+}
+
+void tearDown(void)
+{
+}
+
+// ----------- array_view_read tests -----------
+void test_array_view_read_should_match_in_place_chain(void)
+{
+    array_view_init(&view, source, VIEW_TEST_SIZE, CLAMP_INT16);
+    array_view_offset(&view, 250);
+    array_view_scale(&view, 40);
+    array_view_clamp(&view, -20000, 30000);
+
+    array_offset(expected, VIEW_TEST_SIZE, 250, CLAMP_INT16);
+    array_status_t expected_status = array_scale(expected, VIEW_TEST_SIZE, 40, CLAMP_INT16);
+    array_clamp(expected, VIEW_TEST_SIZE, -20000, 30000);
+
+    array_status_t status = array_view_read(&view, 0U, VIEW_TEST_SIZE, actual);
+
+    TEST_ASSERT_EQUAL(expected_status, status);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, status);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected, actual, VIEW_TEST_SIZE);
+    TEST_ASSERT_EQUAL_INT32(-1000, source[0]); // source untouched
+}
+
+void test_array_view_read_should_materialize_sub_range(void)
+{
+    array_view_init(&view, source, VIEW_TEST_SIZE, CLAMP_INT32);
+    array_view_scale(&view, -3);
+    array_scale(expected, VIEW_TEST_SIZE, -3, CLAMP_INT32);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_view_read(&view, 300U, 10U, actual));
+    TEST_ASSERT_EQUAL_INT32_ARRAY(&expected[300], actual, 10U);
+}
+
+void test_array_view_should_return_error_on_invalid_input(void)
+{
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_view_init(&view, NULL, 1, CLAMP_INT32));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_view_init(&view, source, 0, CLAMP_INT32));
+
+    array_view_init(&view, source, 4U, CLAMP_INT32);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT, array_view_clamp(&view, 5, 4));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT, array_view_read(&view, 2U, 3U, actual));
+
+    for (size_t k = 0U; k < VIEW_MAX_OPS; ++k)
+    {
+        TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_view_offset(&view, 1));
+    }
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT, array_view_offset(&view, 1));
+}
+
+// ----------- array_view_iter tests -----------
+void test_array_view_iter_should_cover_view_in_tiles(void)
+{
+    array_view_iter_t iter;
+    const int32_t* tile = NULL;
+    size_t count = 0U;
+    size_t pos = 0U;
+    size_t tiles = 0U;
+
+    array_view_init(&view, source, VIEW_TEST_SIZE, CLAMP_INT8);
+    array_view_offset(&view, -900);
+    array_offset(expected, VIEW_TEST_SIZE, -900, CLAMP_INT8);
+
+    array_view_iter_init(&iter, &view);
+    while (array_view_iter_next(&iter, &tile, &count))
+    {
+        TEST_ASSERT_TRUE(count <= VIEW_TILE);
+        memcpy(&actual[pos], tile, count * sizeof(int32_t));
+        pos += count;
+        tiles++;
+    }
+
+    TEST_ASSERT_EQUAL_size_t(VIEW_TEST_SIZE, pos);
+    TEST_ASSERT_EQUAL_size_t(4U, tiles);
+    TEST_ASSERT_TRUE(iter.clamped);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected, actual, VIEW_TEST_SIZE);
+}
+
+// ----------- view statistics tests -----------
+void test_array_view_stats_should_match_materialized_array(void)
+{
+    int32_t min = 0;
+    int32_t max = 0;
+    int32_t mean = 0;
+    int64_t sum = 0;
+    int64_t expected_sum = 0;
+
+    array_view_init(&view, source, VIEW_TEST_SIZE, CLAMP_INT32);
+    array_view_scale(&view, 1000);
+    array_view_offset(&view, 7);
+    array_scale(expected, VIEW_TEST_SIZE, 1000, CLAMP_INT32);
+    array_offset(expected, VIEW_TEST_SIZE, 7, CLAMP_INT32);
+
+    for (size_t i = 0U; i < VIEW_TEST_SIZE; ++i)
+    {
+        expected_sum += expected[i];
+    }
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_view_min(&view, &min));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_view_max(&view, &max));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_view_sum(&view, &sum));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_view_mean(&view, &mean));
+
+    TEST_ASSERT_EQUAL_INT32(-1000 * 1000 + 7, min);
+    TEST_ASSERT_EQUAL_INT32(1000 * 1000 + 7, max);
+    TEST_ASSERT_EQUAL_INT64(expected_sum, sum);
+    TEST_ASSERT_EQUAL_INT32((int32_t) (expected_sum / (int64_t) VIEW_TEST_SIZE), mean);
+}
+
+void test_array_view_stats_should_report_saturated_view(void)
+{
+    int32_t min = 0;
+    int32_t max = 0;
+    int32_t mean = 0;
+    int64_t sum = 0;
+    int64_t expected_sum = 0;
+
+    array_view_init(&view, source, VIEW_TEST_SIZE, CLAMP_INT8);
+    array_view_offset(&view, -900);
+    array_offset(expected, VIEW_TEST_SIZE, -900, CLAMP_INT8);
+
+    for (size_t i = 0U; i < VIEW_TEST_SIZE; ++i)
+    {
+        expected_sum += expected[i];
+    }
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP,
+                      array_view_stats(&view, NULL, NULL, NULL));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, array_view_min(&view, &min));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, array_view_max(&view, &max));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, array_view_sum(&view, &sum));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP, array_view_mean(&view, &mean));
+
+    TEST_ASSERT_EQUAL_INT32(INT8_MIN, min);
+    TEST_ASSERT_EQUAL_INT32(100, max);
+    TEST_ASSERT_EQUAL_INT64(expected_sum, sum);
+    TEST_ASSERT_EQUAL_INT32((int32_t) (expected_sum / (int64_t) VIEW_TEST_SIZE), mean);
+}
+
+void test_array_view_should_coexist_with_array_stats(void)
+{
+    // Both headers share array_status_t from array_status.h
+    const int values[] = {4, 8, 6};
+    int sum = 0;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_sum(values, 3, &sum));
+    TEST_ASSERT_EQUAL_INT(18, sum);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- array_view_read tests -----------
+    RUN_TEST(test_array_view_read_should_match_in_place_chain);
+    RUN_TEST(test_array_view_read_should_materialize_sub_range);
+    RUN_TEST(test_array_view_should_return_error_on_invalid_input);
+
+    // ----------- array_view_iter tests -----------
+    RUN_TEST(test_array_view_iter_should_cover_view_in_tiles);
+
+    // ----------- view statistics tests -----------
+    RUN_TEST(test_array_view_stats_should_match_materialized_array);
+    RUN_TEST(test_array_view_stats_should_report_saturated_view);
+    RUN_TEST(test_array_view_should_coexist_with_array_stats);
+
+    return UNITY_END();
+}
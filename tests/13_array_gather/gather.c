@@ -0,0 +1,145 @@
+#include "array/array_gather.h"
+#include "unity.h"
+
+#define GATHER_SIZE 500U
+
+static int32_t data[GATHER_SIZE];
+static int32_t expected[GATHER_SIZE];
+
+void setUp(void)
+{
+    for (size_t i = 0U; i < GATHER_SIZE; ++i)
+    {
+        data[i] = (int32_t) ((i * 7919U) % 255U) - 127;
+        expected[i] = data[i];
+    }
+}
+
+void tearDown(void)
+{
+}
+
+// ----------- gather / scatter tests -----------
+void test_array_gather_should_collect_indexed_elements(void)
+{
+    const int32_t src[] = {10, 20, 30, 40, 50};
+    const size_t idx[] = {4, 0, 0, 2};
+    const int32_t want[] = {50, 10, 10, 30};
+    int32_t dst[4];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_gather(src, 5, idx, 4, dst));
+    TEST_ASSERT_EQUAL_INT32_ARRAY(want, dst, 4);
+}
+
+void test_array_scatter_should_write_indexed_elements(void)
+{
+    const int32_t src[] = {1, 2, 3};
+    const size_t idx[] = {3, 0, 3};
+    int32_t dst[] = {0, 0, 0, 0};
+    const int32_t want[] = {2, 0, 0, 3};
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_scatter(src, 3, idx, dst, 4));
+    TEST_ASSERT_EQUAL_INT32_ARRAY(want, dst, 4);
+}
+
+void test_array_gather_should_reject_out_of_range_index(void)
+{
+    const int32_t src[] = {1, 2};
+    const size_t idx[] = {0, 2};
+    int32_t dst[] = {-1, -1};
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT, array_gather(src, 2, idx, 2, dst));
+    TEST_ASSERT_EQUAL_INT32(-1, dst[0]);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT, array_scatter(src, 2, idx, dst, 2));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_gather(NULL, 2, idx, 2, dst));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_gather(src, 2, idx, 0, dst));
+}
+
+// ----------- indexed transform tests -----------
+void test_array_offset_indexed_should_saturate_like_array_offset(void)
+{
+    const size_t idx[] = {7, 3, 499, 3};
+    int32_t single[1];
+
+    array_status_t status = array_offset_indexed(data, GATHER_SIZE, idx, 4, 100, CLAMP_INT8);
+
+    // Reference: apply array_offset element by element (index 3 twice)
+    array_status_t ref = ARRAY_STATUS_OK;
+    for (size_t k = 0U; k < 4U; ++k)
+    {
+        single[0] = expected[idx[k]];
+        if (array_offset(single, 1, 100, CLAMP_INT8) == ARRAY_STATUS_WARNING_OVERFLOW_CLAMP)
+        {
+            ref = ARRAY_STATUS_WARNING_OVERFLOW_CLAMP;
+        }
+        expected[idx[k]] = single[0];
+    }
+
+    TEST_ASSERT_EQUAL(ref, status);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected, data, GATHER_SIZE);
+}
+
+void test_array_scale_indexed_should_coalesce_sorted_runs(void)
+{
+    // Sorted list: a long contiguous run (dense path) plus isolated indices (scalar path)
+    static size_t idx[GATHER_SIZE];
+    size_t count = 0U;
+
+    idx[count++] = 2U;
+    for (size_t i = 100U; i < 300U; ++i)
+    {
+        idx[count++] = i;
+    }
+    idx[count++] = 301U;
+    idx[count++] = 450U;
+
+    array_status_t status = array_scale_indexed(data, GATHER_SIZE, idx, count, -300, CLAMP_INT16);
+
+    array_scale(&expected[2], 1, -300, CLAMP_INT16);
+    array_status_t ref = array_scale(&expected[100], 200, -300, CLAMP_INT16);
+    array_scale(&expected[301], 1, -300, CLAMP_INT16);
+    array_scale(&expected[450], 1, -300, CLAMP_INT16);
+
+    TEST_ASSERT_EQUAL(ref, status);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected, data, GATHER_SIZE);
+}
+
+void test_array_clamp_indexed_should_only_touch_listed_elements(void)
+{
+    int32_t arr[] = {-50, 50, -50, 50};
+    const size_t idx[] = {1, 2};
+    const int32_t want[] = {-50, 10, -10, 50};
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_clamp_indexed(arr, 4, idx, 2, -10, 10));
+    TEST_ASSERT_EQUAL_INT32_ARRAY(want, arr, 4);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT, array_clamp_indexed(arr, 4, idx, 2, 1, 0));
+}
+
+void test_array_offset_indexed_should_validate_before_writing(void)
+{
+    const size_t idx[] = {0, GATHER_SIZE};
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_offset_indexed(data, GATHER_SIZE, idx, 2, 1, CLAMP_INT32));
+    TEST_ASSERT_EQUAL_INT32(expected[0], data[0]);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OFFSET_IS_ZERO,
+                      array_offset_indexed(data, GATHER_SIZE, idx, 1, 0, CLAMP_INT32));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- gather / scatter tests -----------
+    RUN_TEST(test_array_gather_should_collect_indexed_elements);
+    RUN_TEST(test_array_scatter_should_write_indexed_elements);
+    RUN_TEST(test_array_gather_should_reject_out_of_range_index);
+
+    // ----------- indexed transform tests -----------
+    RUN_TEST(test_array_offset_indexed_should_saturate_like_array_offset);
+    RUN_TEST(test_array_scale_indexed_should_coalesce_sorted_runs);
+    RUN_TEST(test_array_clamp_indexed_should_only_touch_listed_elements);
+    RUN_TEST(test_array_offset_indexed_should_validate_before_writing);
+
+    return UNITY_END();
+}
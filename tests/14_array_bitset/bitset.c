@@ -0,0 +1,197 @@
+#include "array/array_bitset.h"
+#include "unity.h"
+
+#define BITSET_SIZE 200U
+
+static uint64_t words_a[BITSET_WORDS(BITSET_SIZE)];
+static uint64_t words_b[BITSET_WORDS(BITSET_SIZE)];
+static uint64_t words_c[BITSET_WORDS(BITSET_SIZE)];
+static array_bitset_t a;
+static array_bitset_t b;
+static array_bitset_t c;
+
+void setUp(void)
+{
+    array_bitset_init(&a, words_a, BITSET_SIZE);
+    array_bitset_init(&b, words_b, BITSET_SIZE);
+    array_bitset_init(&c, words_c, BITSET_SIZE);
+}
+
+void tearDown(void)
+{
+}
+
+// ----------- range tests -----------
+void test_array_bitset_set_range_should_span_word_boundaries(void)
+{
+    size_t count = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_bitset_set_range(&a, 60, 80));
+
+    for (size_t i = 0U; i < BITSET_SIZE; ++i)
+    {
+        TEST_ASSERT_EQUAL(i >= 60U && i < 140U, array_bitset_test(&a, i));
+    }
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_bitset_popcount(&a, &count));
+    TEST_ASSERT_EQUAL_size_t(80, count);
+}
+
+void test_array_bitset_clear_range_should_leave_neighbours(void)
+{
+    size_t count = 0U;
+
+    array_bitset_set_range(&a, 0, BITSET_SIZE);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_bitset_clear_range(&a, 63, 2));
+
+    TEST_ASSERT_TRUE(array_bitset_test(&a, 62));
+    TEST_ASSERT_FALSE(array_bitset_test(&a, 63));
+    TEST_ASSERT_FALSE(array_bitset_test(&a, 64));
+    TEST_ASSERT_TRUE(array_bitset_test(&a, 65));
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_bitset_count_range(&a, 60, 10, &count));
+    TEST_ASSERT_EQUAL_size_t(8, count);
+}
+
+void test_array_bitset_set_range_should_keep_tail_bits_clear(void)
+{
+    array_bitset_set_range(&a, 0, BITSET_SIZE);
+
+    // 200 bits = 3 full words + 8 bits of the last one
+    TEST_ASSERT_EQUAL_HEX64(0xFFU, words_a[3]);
+}
+
+void test_array_bitset_range_should_reject_out_of_bounds(void)
+{
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT, array_bitset_set_range(&a, 150, 51));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_bitset_clear_range(&a, 0, 0));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_bitset_set_range(NULL, 0, 1));
+    TEST_ASSERT_FALSE(array_bitset_test(&a, BITSET_SIZE));
+}
+
+// ----------- logical operation tests -----------
+void test_array_bitset_logical_ops_should_combine_words(void)
+{
+    size_t count = 0U;
+
+    array_bitset_set_range(&a, 0, 100);
+    array_bitset_set_range(&b, 50, 100);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_bitset_and(&c, &a, &b));
+    array_bitset_popcount(&c, &count);
+    TEST_ASSERT_EQUAL_size_t(50, count);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_bitset_or(&c, &a, &b));
+    array_bitset_popcount(&c, &count);
+    TEST_ASSERT_EQUAL_size_t(150, count);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_bitset_xor(&c, &a, &b));
+    array_bitset_popcount(&c, &count);
+    TEST_ASSERT_EQUAL_size_t(100, count);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_bitset_andnot(&c, &a, &b));
+    array_bitset_popcount(&c, &count);
+    TEST_ASSERT_EQUAL_size_t(50, count);
+    TEST_ASSERT_TRUE(array_bitset_test(&c, 49));
+    TEST_ASSERT_FALSE(array_bitset_test(&c, 50));
+}
+
+void test_array_bitset_logical_ops_should_allow_in_place(void)
+{
+    size_t count = 0U;
+
+    array_bitset_set_range(&a, 10, 20);
+    array_bitset_set_range(&b, 20, 20);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_bitset_and(&a, &a, &b));
+    array_bitset_popcount(&a, &count);
+    TEST_ASSERT_EQUAL_size_t(10, count);
+}
+
+void test_array_bitset_logical_ops_should_reject_size_mismatch(void)
+{
+    uint64_t small_words[1];
+    array_bitset_t small;
+
+    array_bitset_init(&small, small_words, 64);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT, array_bitset_or(&c, &a, &small));
+}
+
+// ----------- search / index list tests -----------
+void test_array_bitset_find_next_should_skip_empty_words(void)
+{
+    size_t index = 0U;
+
+    array_bitset_set_range(&a, 5, 1);
+    array_bitset_set_range(&a, 190, 1);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_bitset_find_first(&a, &index));
+    TEST_ASSERT_EQUAL_size_t(5, index);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_bitset_find_next(&a, 6, &index));
+    TEST_ASSERT_EQUAL_size_t(190, index);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_bitset_find_next(&a, 191, &index));
+    TEST_ASSERT_EQUAL_size_t(BITSET_SIZE, index);
+}
+
+void test_array_bitset_indices_should_round_trip(void)
+{
+    const size_t idx[] = {199, 0, 64, 63, 128, 64};
+    const size_t want[] = {0, 63, 64, 128, 199};
+    size_t out[8];
+    size_t count = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_bitset_from_indices(&a, idx, 6));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_bitset_to_indices(&a, out, 8, &count));
+    TEST_ASSERT_EQUAL_size_t(5, count);
+    TEST_ASSERT_EQUAL_UINT64_ARRAY(want, out, 5);
+}
+
+void test_array_bitset_to_indices_should_truncate_to_capacity(void)
+{
+    size_t out[3];
+    size_t count = 0U;
+
+    array_bitset_set_range(&a, 10, 10);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_WARNING_OVERFLOW_CLAMP,
+                      array_bitset_to_indices(&a, out, 3, &count));
+    TEST_ASSERT_EQUAL_size_t(3, count);
+    TEST_ASSERT_EQUAL_size_t(12, out[2]);
+}
+
+void test_array_bitset_from_indices_should_validate_before_writing(void)
+{
+    const size_t idx[] = {1, 2, BITSET_SIZE};
+    size_t count = 1U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT, array_bitset_from_indices(&a, idx, 3));
+    array_bitset_popcount(&a, &count);
+    TEST_ASSERT_EQUAL_size_t(0, count);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- range tests -----------
+    RUN_TEST(test_array_bitset_set_range_should_span_word_boundaries);
+    RUN_TEST(test_array_bitset_clear_range_should_leave_neighbours);
+    RUN_TEST(test_array_bitset_set_range_should_keep_tail_bits_clear);
+    RUN_TEST(test_array_bitset_range_should_reject_out_of_bounds);
+
+    // ----------- logical operation tests -----------
+    RUN_TEST(test_array_bitset_logical_ops_should_combine_words);
+    RUN_TEST(test_array_bitset_logical_ops_should_allow_in_place);
+    RUN_TEST(test_array_bitset_logical_ops_should_reject_size_mismatch);
+
+    // ----------- search / index list tests -----------
+    RUN_TEST(test_array_bitset_find_next_should_skip_empty_words);
+    RUN_TEST(test_array_bitset_indices_should_round_trip);
+    RUN_TEST(test_array_bitset_to_indices_should_truncate_to_capacity);
+    RUN_TEST(test_array_bitset_from_indices_should_validate_before_writing);
+
+    return UNITY_END();
+}
@@ -0,0 +1,132 @@
+#include "array/array_filter.h"
+#include "unity.h"
+
+#define FILTER_SIZE 1000U
+
+static int32_t data[FILTER_SIZE];
+static int32_t out[FILTER_SIZE];
+static size_t out_idx[FILTER_SIZE];
+
+void setUp(void)
+{
+    uint32_t state = 12345U;
+
+    for (size_t i = 0U; i < FILTER_SIZE; ++i)
+    {
+        state = state * 1664525U + 1013904223U;
+        data[i] = (int32_t) (state >> 16) - 32768;
+    }
+}
+
+void tearDown(void)
+{
+}
+
+// ----------- compaction tests -----------
+void test_array_filter_should_match_branchy_reference(void)
+{
+    const filter_pred_t preds[] = {FILTER_PRED_IN_RANGE, FILTER_PRED_GT, FILTER_PRED_LT,
+                                   FILTER_PRED_EQ, FILTER_PRED_NE};
+
+    for (size_t p = 0U; p < 5U; ++p)
+    {
+        int32_t a = (preds[p] == FILTER_PRED_EQ) ? data[17] : -1000;
+        int32_t b = 5000;
+        int32_t want[FILTER_SIZE];
+        size_t want_count = 0U;
+        size_t count = 0U;
+
+        for (size_t i = 0U; i < FILTER_SIZE; ++i)
+        {
+            if (filter_match(data[i], preds[p], a, b))
+            {
+                want[want_count++] = data[i];
+            }
+        }
+
+        TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                          array_filter(data, FILTER_SIZE, out, preds[p], a, b, &count));
+        TEST_ASSERT_EQUAL_size_t(want_count, count);
+        TEST_ASSERT_EQUAL_INT32_ARRAY(want, out, count);
+    }
+}
+
+void test_array_filter_in_range_should_handle_extreme_bounds(void)
+{
+    const int32_t src[] = {INT32_MIN, -1, 0, 1, INT32_MAX};
+    const int32_t want[] = {INT32_MIN, -1, 0};
+    int32_t dst[5];
+    size_t count = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_filter_in_range(src, 5, dst, INT32_MIN, 0, &count));
+    TEST_ASSERT_EQUAL_size_t(3, count);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(want, dst, 3);
+}
+
+void test_array_filter_gt_should_work_in_place(void)
+{
+    int32_t values[] = {5, -3, 8, 0, 9, 1};
+    const int32_t want[] = {5, 8, 9};
+    size_t count = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_filter_gt(values, 6, values, 4, &count));
+    TEST_ASSERT_EQUAL_size_t(3, count);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(want, values, 3);
+}
+
+void test_array_filter_should_report_zero_survivors(void)
+{
+    size_t count = 99U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_filter_gt(data, FILTER_SIZE, out, INT32_MAX, &count));
+    TEST_ASSERT_EQUAL_size_t(0, count);
+}
+
+void test_array_filter_should_reject_invalid_arguments(void)
+{
+    size_t count = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_filter_gt(NULL, 4, out, 0, &count));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_filter_gt(data, 4, out, 0, NULL));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_filter_gt(data, 0, out, 0, &count));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_filter_in_range(data, 4, out, 10, -10, &count));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_filter(data, 4, out, (filter_pred_t) 42, 0, 0, &count));
+}
+
+// ----------- index tests -----------
+void test_array_filter_indices_should_point_at_survivors(void)
+{
+    size_t count = 0U;
+    size_t values = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_filter_indices(data, FILTER_SIZE, out_idx,
+                                                            FILTER_PRED_LT, 0, 0, &count));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                      array_filter(data, FILTER_SIZE, out, FILTER_PRED_LT, 0, 0, &values));
+    TEST_ASSERT_EQUAL_size_t(values, count);
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+        TEST_ASSERT_EQUAL_INT32(out[i], data[out_idx[i]]);
+        TEST_ASSERT_TRUE(i == 0U || out_idx[i] > out_idx[i - 1U]);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- compaction tests -----------
+    RUN_TEST(test_array_filter_should_match_branchy_reference);
+    RUN_TEST(test_array_filter_in_range_should_handle_extreme_bounds);
+    RUN_TEST(test_array_filter_gt_should_work_in_place);
+    RUN_TEST(test_array_filter_should_report_zero_survivors);
+    RUN_TEST(test_array_filter_should_reject_invalid_arguments);
+
+    // ----------- index tests -----------
+    RUN_TEST(test_array_filter_indices_should_point_at_survivors);
+
+    return UNITY_END();
+}
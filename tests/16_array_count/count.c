@@ -0,0 +1,132 @@
+#include "array/array_count.h"
+#include "unity.h"
+
+#define COUNT_SIZE 1000U
+
+static int32_t data[COUNT_SIZE];
+
+void setUp(void)
+{
+    for (size_t i = 0U; i < COUNT_SIZE; ++i)
+    {
+        data[i] = (int32_t) ((i * 7919U) % 401U) - 200;
+    }
+}
+
+void tearDown(void)
+{
+}
+
+static size_t reference_count(filter_pred_t pred, int32_t a, int32_t b)
+{
+    size_t count = 0U;
+
+    for (size_t i = 0U; i < COUNT_SIZE; ++i)
+    {
+        int32_t x = data[i];
+        bool match = (pred == FILTER_PRED_IN_RANGE) ? (x >= a && x <= b)
+                   : (pred == FILTER_PRED_GT)       ? (x > a)
+                   : (pred == FILTER_PRED_LT)       ? (x < a)
+                                                    : (x == a);
+        count += match ? 1U : 0U;
+    }
+
+    return count;
+}
+
+// ----------- counting tests -----------
+void test_array_count_should_match_reference(void)
+{
+    size_t count = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_count_in_range(data, COUNT_SIZE, -50, 75, &count));
+    TEST_ASSERT_EQUAL_size_t(reference_count(FILTER_PRED_IN_RANGE, -50, 75), count);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_count_gt(data, COUNT_SIZE, 100, &count));
+    TEST_ASSERT_EQUAL_size_t(reference_count(FILTER_PRED_GT, 100, 0), count);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_count_lt(data, COUNT_SIZE, -199, &count));
+    TEST_ASSERT_EQUAL_size_t(reference_count(FILTER_PRED_LT, -199, 0), count);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_count_eq(data, COUNT_SIZE, 0, &count));
+    TEST_ASSERT_EQUAL_size_t(reference_count(FILTER_PRED_EQ, 0, 0), count);
+}
+
+void test_array_count_in_range_should_cover_full_int32_range(void)
+{
+    const int32_t values[] = {INT32_MIN, -1, 0, INT32_MAX};
+    size_t count = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                      array_count_in_range(values, 4, INT32_MIN, INT32_MAX, &count));
+    TEST_ASSERT_EQUAL_size_t(4, count);
+}
+
+void test_array_count_should_reject_invalid_arguments(void)
+{
+    size_t count = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_count_gt(NULL, 4, 0, &count));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_count_eq(data, 4, 0, NULL));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_count_lt(data, 0, 0, &count));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_count_in_range(data, 4, 5, 4, &count));
+}
+
+// ----------- any / all tests -----------
+void test_array_any_should_find_single_match_in_last_block(void)
+{
+    bool any = false;
+
+    data[COUNT_SIZE - 1U] = 5000;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                      array_any(data, COUNT_SIZE, FILTER_PRED_GT, 1000, 0, &any));
+    TEST_ASSERT_TRUE(any);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                      array_any(data, COUNT_SIZE, FILTER_PRED_GT, 5000, 0, &any));
+    TEST_ASSERT_FALSE(any);
+}
+
+void test_array_all_should_detect_single_outlier(void)
+{
+    bool all = false;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                      array_all(data, COUNT_SIZE, FILTER_PRED_IN_RANGE, -200, 200, &all));
+    TEST_ASSERT_TRUE(all);
+
+    data[300] = -201;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                      array_all(data, COUNT_SIZE, FILTER_PRED_IN_RANGE, -200, 200, &all));
+    TEST_ASSERT_FALSE(all);
+}
+
+void test_array_any_should_reject_unknown_predicate(void)
+{
+    bool any = false;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_any(data, COUNT_SIZE, (filter_pred_t) 9, 0, 0, &any));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL,
+                      array_all(data, COUNT_SIZE, FILTER_PRED_EQ, 0, 0, NULL));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- counting tests -----------
+    RUN_TEST(test_array_count_should_match_reference);
+    RUN_TEST(test_array_count_in_range_should_cover_full_int32_range);
+    RUN_TEST(test_array_count_should_reject_invalid_arguments);
+
+    // ----------- any / all tests -----------
+    RUN_TEST(test_array_any_should_find_single_match_in_last_block);
+    RUN_TEST(test_array_all_should_detect_single_outlier);
+    RUN_TEST(test_array_any_should_reject_unknown_predicate);
+
+    return UNITY_END();
+}
@@ -0,0 +1,143 @@
+#include "array/array_search.h"
+#include "unity.h"
+
+#define SEARCH_SIZE 300U
+
+static int32_t data[SEARCH_SIZE];
+
+void setUp(void)
+{
+    for (size_t i = 0U; i < SEARCH_SIZE; ++i)
+    {
+        data[i] = (int32_t) (i % 50U);
+    }
+}
+
+void tearDown(void)
+{
+}
+
+// ----------- occurrence tests -----------
+void test_array_find_should_return_first_and_last_occurrence(void)
+{
+    size_t index = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_find(data, SEARCH_SIZE, 49, &index));
+    TEST_ASSERT_EQUAL_size_t(49, index);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_find_last(data, SEARCH_SIZE, 3, &index));
+    TEST_ASSERT_EQUAL_size_t(253, index);
+}
+
+void test_array_find_should_report_size_when_missing(void)
+{
+    size_t index = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_find(data, SEARCH_SIZE, -1, &index));
+    TEST_ASSERT_EQUAL_size_t(SEARCH_SIZE, index);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_find_last(data, SEARCH_SIZE, 50, &index));
+    TEST_ASSERT_EQUAL_size_t(SEARCH_SIZE, index);
+}
+
+void test_array_find_should_handle_partial_blocks(void)
+{
+    const int32_t small[] = {1, 2, 3, 2, 1};
+    size_t index = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_find(small, 5, 2, &index));
+    TEST_ASSERT_EQUAL_size_t(1, index);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_find_last(small, 5, 2, &index));
+    TEST_ASSERT_EQUAL_size_t(3, index);
+
+    data[SEARCH_SIZE - 1U] = 1000;
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_find(data, SEARCH_SIZE, 1000, &index));
+    TEST_ASSERT_EQUAL_size_t(SEARCH_SIZE - 1U, index);
+}
+
+void test_array_find_should_reject_invalid_arguments(void)
+{
+    size_t index = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_find(NULL, 4, 0, &index));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_find_last(data, 4, 0, NULL));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_find_first_gt(data, 0, 0, &index));
+}
+
+// ----------- threshold tests -----------
+void test_array_find_first_gt_lt_should_use_strict_compare(void)
+{
+    size_t index = 0U;
+
+    data[200] = -5;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_find_first_gt(data, SEARCH_SIZE, 48, &index));
+    TEST_ASSERT_EQUAL_size_t(49, index);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_find_first_lt(data, SEARCH_SIZE, 0, &index));
+    TEST_ASSERT_EQUAL_size_t(200, index);
+}
+
+void test_array_find_crossing_should_detect_edges(void)
+{
+    const int32_t signal[] = {0, 5, 10, 10, 4, 12, 3};
+    size_t index = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                      array_find_crossing(signal, 7, 10, SEARCH_EDGE_RISING, &index));
+    TEST_ASSERT_EQUAL_size_t(2, index);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                      array_find_crossing(signal, 7, 10, SEARCH_EDGE_FALLING, &index));
+    TEST_ASSERT_EQUAL_size_t(4, index);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                      array_find_crossing(signal, 7, 11, SEARCH_EDGE_ANY, &index));
+    TEST_ASSERT_EQUAL_size_t(5, index);
+}
+
+void test_array_find_crossing_should_span_block_boundary(void)
+{
+    size_t index = 0U;
+
+    for (size_t i = 0U; i < SEARCH_SIZE; ++i)
+    {
+        data[i] = (i < SEARCH_BLOCK + 1U) ? 0 : 100;
+    }
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                      array_find_crossing(data, SEARCH_SIZE, 50, SEARCH_EDGE_RISING, &index));
+    TEST_ASSERT_EQUAL_size_t(SEARCH_BLOCK + 1U, index);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                      array_find_crossing(data, SEARCH_SIZE, 50, SEARCH_EDGE_FALLING, &index));
+    TEST_ASSERT_EQUAL_size_t(SEARCH_SIZE, index);
+}
+
+void test_array_find_crossing_should_reject_unknown_edge(void)
+{
+    size_t index = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_find_crossing(data, SEARCH_SIZE, 0, (search_edge_t) 7, &index));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- occurrence tests -----------
+    RUN_TEST(test_array_find_should_return_first_and_last_occurrence);
+    RUN_TEST(test_array_find_should_report_size_when_missing);
+    RUN_TEST(test_array_find_should_handle_partial_blocks);
+    RUN_TEST(test_array_find_should_reject_invalid_arguments);
+
+    // ----------- threshold tests -----------
+    RUN_TEST(test_array_find_first_gt_lt_should_use_strict_compare);
+    RUN_TEST(test_array_find_crossing_should_detect_edges);
+    RUN_TEST(test_array_find_crossing_should_span_block_boundary);
+    RUN_TEST(test_array_find_crossing_should_reject_unknown_edge);
+
+    return UNITY_END();
+}
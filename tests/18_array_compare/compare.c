@@ -0,0 +1,137 @@
+#include "array/array_compare.h"
+#include "unity.h"
+
+#define COMPARE_SIZE 500U
+
+static int32_t frame[COMPARE_SIZE];
+static int32_t copy[COMPARE_SIZE];
+
+void setUp(void)
+{
+    for (size_t i = 0U; i < COMPARE_SIZE; ++i)
+    {
+        frame[i] = (int32_t) ((i * 2654435761U) >> 8);
+        copy[i] = frame[i];
+    }
+}
+
+void tearDown(void)
+{
+}
+
+// ----------- equality tests -----------
+void test_array_equal_should_detect_single_difference(void)
+{
+    bool equal = false;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_equal(frame, copy, COMPARE_SIZE, &equal));
+    TEST_ASSERT_TRUE(equal);
+
+    copy[COMPARE_SIZE - 1U] ^= 1;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_equal(frame, copy, COMPARE_SIZE, &equal));
+    TEST_ASSERT_FALSE(equal);
+}
+
+void test_array_first_mismatch_should_return_lowest_index(void)
+{
+    size_t index = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_first_mismatch(frame, copy, COMPARE_SIZE, &index));
+    TEST_ASSERT_EQUAL_size_t(COMPARE_SIZE, index);
+
+    copy[300] = ~copy[300];
+    copy[130] = ~copy[130];
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_first_mismatch(frame, copy, COMPARE_SIZE, &index));
+    TEST_ASSERT_EQUAL_size_t(130, index);
+}
+
+void test_array_equal_should_reject_invalid_arguments(void)
+{
+    bool equal = false;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_equal(NULL, copy, 4, &equal));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_first_mismatch(frame, copy, 4, NULL));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_equal(frame, copy, 0, &equal));
+}
+
+// ----------- block diff tests -----------
+void test_array_block_diff_should_list_changed_blocks(void)
+{
+    size_t blocks[COMPARE_BLOCKS(COMPARE_SIZE, 100U)];
+    const size_t want[] = {0, 2, 4};
+    size_t count = 0U;
+
+    copy[0] += 1;
+    copy[250] += 1;
+    copy[299] += 1;
+    copy[499] += 1;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                      array_block_diff(frame, copy, COMPARE_SIZE, 100, blocks, &count));
+    TEST_ASSERT_EQUAL_size_t(3, count);
+    TEST_ASSERT_EQUAL_UINT64_ARRAY(want, blocks, 3);
+}
+
+void test_array_block_diff_should_handle_short_last_block(void)
+{
+    size_t blocks[COMPARE_BLOCKS(COMPARE_SIZE, 64U)];
+    size_t count = 0U;
+
+    copy[COMPARE_SIZE - 1U] += 1;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK,
+                      array_block_diff(frame, copy, COMPARE_SIZE, 64, blocks, &count));
+    TEST_ASSERT_EQUAL_size_t(1, count);
+    TEST_ASSERT_EQUAL_size_t(7, blocks[0]);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_block_diff(frame, copy, COMPARE_SIZE, 0, blocks, &count));
+}
+
+// ----------- checksum tests -----------
+void test_array_checksum_should_reject_without_full_compare(void)
+{
+    uint64_t frame_sum = 0U;
+    uint64_t copy_sum = 0U;
+    bool equal = false;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_checksum(frame, COMPARE_SIZE, &frame_sum));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_checksum(copy, COMPARE_SIZE, &copy_sum));
+    TEST_ASSERT_EQUAL_HEX64(frame_sum, copy_sum);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_equal_checksum(frame, frame_sum, copy, copy_sum,
+                                                            COMPARE_SIZE, &equal));
+    TEST_ASSERT_TRUE(equal);
+
+    // Swapping two elements keeps the plain sum but changes the weighted one
+    int32_t tmp = copy[10];
+    copy[10] = copy[11];
+    copy[11] = tmp;
+    array_checksum(copy, COMPARE_SIZE, &copy_sum);
+    TEST_ASSERT_NOT_EQUAL(frame_sum, copy_sum);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_equal_checksum(frame, frame_sum, copy, copy_sum,
+                                                            COMPARE_SIZE, &equal));
+    TEST_ASSERT_FALSE(equal);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- equality tests -----------
+    RUN_TEST(test_array_equal_should_detect_single_difference);
+    RUN_TEST(test_array_first_mismatch_should_return_lowest_index);
+    RUN_TEST(test_array_equal_should_reject_invalid_arguments);
+
+    // ----------- block diff tests -----------
+    RUN_TEST(test_array_block_diff_should_list_changed_blocks);
+    RUN_TEST(test_array_block_diff_should_handle_short_last_block);
+
+    // ----------- checksum tests -----------
+    RUN_TEST(test_array_checksum_should_reject_without_full_compare);
+
+    return UNITY_END();
+}
@@ -0,0 +1,150 @@
+#include "array/array_hash.h"
+#include "array/array_stats.h"
+#include "unity.h"
+
+#define HASH_SIZE 1000U
+
+static int32_t data[HASH_SIZE];
+
+void setUp(void)
+{
+    for (size_t i = 0U; i < HASH_SIZE; ++i)
+    {
+        data[i] = (int32_t) (i * 2654435761U);
+    }
+}
+
+void tearDown(void)
+{
+}
+
+// ----------- CRC32C tests -----------
+void test_array_crc32c_should_match_reference_vector(void)
+{
+    // CRC32C("123456789") = 0xE3069283; both paths must agree with it
+    const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+    TEST_ASSERT_EQUAL_HEX32(0xE3069283U, ~hash_crc32c_sw(0xFFFFFFFFU, check, 9));
+    TEST_ASSERT_EQUAL_HEX32(0xE3069283U, ~hash_crc32c_bytes(0xFFFFFFFFU, check, 9));
+}
+
+void test_array_crc32c_should_match_software_path(void)
+{
+    uint32_t crc = 0U;
+    uint32_t sw = ~hash_crc32c_sw(0xFFFFFFFFU, (const uint8_t*) data, sizeof(data));
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_crc32c(data, HASH_SIZE, &crc));
+    TEST_ASSERT_EQUAL_HEX32(sw, crc);
+}
+
+void test_array_crc32c_streaming_and_combine_should_match_one_shot(void)
+{
+    array_crc32c_t state;
+    uint32_t whole = 0U;
+    uint32_t streamed = 0U;
+    uint32_t first = 0U;
+    uint32_t second = 0U;
+
+    array_crc32c(data, HASH_SIZE, &whole);
+
+    array_crc32c_init(&state);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_crc32c_update(&state, data, 333));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_crc32c_update(&state, data + 333, HASH_SIZE - 333U));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_crc32c_final(&state, &streamed));
+    TEST_ASSERT_EQUAL_HEX32(whole, streamed);
+
+    array_crc32c(data, 333, &first);
+    array_crc32c(data + 333, HASH_SIZE - 333U, &second);
+    TEST_ASSERT_EQUAL_HEX32(whole, array_crc32c_combine(first, second, HASH_SIZE - 333U));
+}
+
+void test_array_crc32c_should_reject_invalid_arguments(void)
+{
+    uint32_t crc = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_crc32c(NULL, 4, &crc));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_crc32c(data, 4, NULL));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_crc32c(data, 0, &crc));
+}
+
+// ----------- hash64 tests -----------
+void test_array_hash64_chunks_should_combine_in_any_order(void)
+{
+    array_hash64_t parts[3];
+    array_hash64_t merged;
+    uint64_t whole = 0U;
+    uint64_t combined = 0U;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_hash64(data, HASH_SIZE, &whole));
+
+    array_hash64_chunk(data, 100, 0, &parts[0]);
+    array_hash64_chunk(data + 100, 500, 100, &parts[1]);
+    array_hash64_chunk(data + 600, 400, 600, &parts[2]);
+
+    array_hash64_init(&merged);
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_hash64_combine(&merged, &parts[2]));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_hash64_combine(&merged, &parts[0]));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_hash64_combine(&merged, &parts[1]));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_hash64_final(&merged, &combined));
+
+    TEST_ASSERT_EQUAL_HEX64(whole, combined);
+}
+
+void test_array_hash64_should_depend_on_order_and_length(void)
+{
+    uint64_t base = 0U;
+    uint64_t other = 0U;
+
+    array_hash64(data, HASH_SIZE, &base);
+
+    int32_t tmp = data[5];
+    data[5] = data[6];
+    data[6] = tmp;
+    array_hash64(data, HASH_SIZE, &other);
+    TEST_ASSERT_NOT_EQUAL(base, other);
+
+    data[6] = data[5];
+    data[5] = tmp;
+    array_hash64(data, HASH_SIZE - 1U, &other);
+    TEST_ASSERT_NOT_EQUAL(base, other);
+}
+
+void test_array_hash64_should_key_stats_cache(void)
+{
+    uint64_t cached_key = 0U;
+    uint64_t key = 0U;
+    int cached_max = 0;
+    int max = 0;
+
+    array_hash64(data, HASH_SIZE, &cached_key);
+    array_max(data, HASH_SIZE, &cached_max);
+
+    // Unchanged buffer: same key, cached result still valid
+    array_hash64(data, HASH_SIZE, &key);
+    TEST_ASSERT_EQUAL_HEX64(cached_key, key);
+
+    // Modified buffer: new key, result must be recomputed
+    data[123] = INT32_MAX;
+    array_hash64(data, HASH_SIZE, &key);
+    TEST_ASSERT_NOT_EQUAL(cached_key, key);
+    array_max(data, HASH_SIZE, &max);
+    TEST_ASSERT_EQUAL_INT(INT32_MAX, max);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- CRC32C tests -----------
+    RUN_TEST(test_array_crc32c_should_match_reference_vector);
+    RUN_TEST(test_array_crc32c_should_match_software_path);
+    RUN_TEST(test_array_crc32c_streaming_and_combine_should_match_one_shot);
+    RUN_TEST(test_array_crc32c_should_reject_invalid_arguments);
+
+    // ----------- hash64 tests -----------
+    RUN_TEST(test_array_hash64_chunks_should_combine_in_any_order);
+    RUN_TEST(test_array_hash64_should_depend_on_order_and_length);
+    RUN_TEST(test_array_hash64_should_key_stats_cache);
+
+    return UNITY_END();
+}
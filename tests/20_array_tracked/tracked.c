@@ -0,0 +1,162 @@
+#include "array/array_tracked.h"
+#include "unity.h"
+
+#define TRACKED_SIZE 1000U
+
+static int32_t data[TRACKED_SIZE];
+static tracked_summary_t blocks[TRACKED_BLOCKS(TRACKED_SIZE)];
+static uint64_t dirty_words[TRACKED_DIRTY_WORDS(TRACKED_SIZE)];
+static array_tracked_t tracked;
+
+void setUp(void)
+{
+    for (size_t i = 0U; i < TRACKED_SIZE; ++i)
+    {
+        data[i] = (int32_t) ((i * 7919U) % 2001U) - 1000;
+    }
+
+    array_tracked_init(&tracked, data, TRACKED_SIZE, blocks, dirty_words);
+}
+
+void tearDown(void)
+{
+}
+
+static void assert_matches_full_scan(void)
+{
+    int32_t want_min = INT32_MAX;
+    int32_t want_max = INT32_MIN;
+    int64_t want_sum = 0;
+    int32_t min = 0;
+    int32_t max = 0;
+    int64_t sum = 0;
+
+    for (size_t i = 0U; i < TRACKED_SIZE; ++i)
+    {
+        want_min = (data[i] < want_min) ? data[i] : want_min;
+        want_max = (data[i] > want_max) ? data[i] : want_max;
+        want_sum += data[i];
+    }
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_tracked_stats(&tracked, &min, &max, &sum));
+    TEST_ASSERT_EQUAL_INT32(want_min, min);
+    TEST_ASSERT_EQUAL_INT32(want_max, max);
+    TEST_ASSERT_EQUAL_INT64(want_sum, sum);
+}
+
+// ----------- setup tests -----------
+void test_array_tracked_init_should_summarize_all_blocks(void)
+{
+    assert_matches_full_scan();
+}
+
+void test_array_tracked_init_should_reject_invalid_arguments(void)
+{
+    array_tracked_t other;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL,
+                      array_tracked_init(&other, data, TRACKED_SIZE, NULL, dirty_words));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY,
+                      array_tracked_init(&other, data, 0, blocks, dirty_words));
+}
+
+// ----------- update tests -----------
+void test_array_tracked_set_should_update_stats(void)
+{
+    int32_t max = 0;
+    int64_t sum = 0;
+    int64_t before = 0;
+
+    array_tracked_sum(&tracked, &before);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_tracked_set(&tracked, 500, 5000));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_tracked_max(&tracked, &max));
+    TEST_ASSERT_EQUAL_INT32(5000, max);
+
+    array_tracked_sum(&tracked, &sum);
+    TEST_ASSERT_EQUAL_INT64(before + 5000 - ((int32_t) ((500U * 7919U) % 2001U) - 1000), sum);
+    assert_matches_full_scan();
+}
+
+void test_array_tracked_should_rescan_when_extreme_is_removed(void)
+{
+    int32_t min = 0;
+
+    array_tracked_set(&tracked, 10, -9000);
+    array_tracked_min(&tracked, &min);
+    TEST_ASSERT_EQUAL_INT32(-9000, min);
+
+    // The block holding the minimum loses it; the new minimum lives in another block
+    array_tracked_set(&tracked, 10, 0);
+    array_tracked_set(&tracked, 900, -8000);
+    array_tracked_min(&tracked, &min);
+    TEST_ASSERT_EQUAL_INT32(-8000, min);
+
+    array_tracked_set(&tracked, 900, 0);
+    assert_matches_full_scan();
+}
+
+void test_array_tracked_write_should_mark_spanned_blocks(void)
+{
+    int32_t values[300];
+
+    for (size_t i = 0U; i < 300U; ++i)
+    {
+        values[i] = (int32_t) i * 3;
+    }
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_tracked_write(&tracked, 200, values, 300));
+    assert_matches_full_scan();
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_tracked_write(&tracked, 900, values, 101));
+}
+
+void test_array_tracked_mark_dirty_should_pick_up_external_writes(void)
+{
+    data[TRACKED_SIZE - 1U] = INT32_MIN;
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_tracked_mark_dirty(&tracked, TRACKED_SIZE - 1U, 1));
+    assert_matches_full_scan();
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_tracked_mark_dirty(&tracked, 0, 0));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_tracked_set(&tracked, TRACKED_SIZE, 0));
+}
+
+void test_array_tracked_should_match_full_scan_after_random_updates(void)
+{
+    uint32_t state = 777U;
+
+    for (size_t n = 0U; n < 2000U; ++n)
+    {
+        state = state * 1664525U + 1013904223U;
+        size_t index = (state >> 8) % TRACKED_SIZE;
+        state = state * 1664525U + 1013904223U;
+        array_tracked_set(&tracked, index, (int32_t) state);
+
+        if (n % 97U == 0U)
+        {
+            assert_matches_full_scan();
+        }
+    }
+
+    assert_matches_full_scan();
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- setup tests -----------
+    RUN_TEST(test_array_tracked_init_should_summarize_all_blocks);
+    RUN_TEST(test_array_tracked_init_should_reject_invalid_arguments);
+
+    // ----------- update tests -----------
+    RUN_TEST(test_array_tracked_set_should_update_stats);
+    RUN_TEST(test_array_tracked_should_rescan_when_extreme_is_removed);
+    RUN_TEST(test_array_tracked_write_should_mark_spanned_blocks);
+    RUN_TEST(test_array_tracked_mark_dirty_should_pick_up_external_writes);
+    RUN_TEST(test_array_tracked_should_match_full_scan_after_random_updates);
+
+    return UNITY_END();
+}
@@ -0,0 +1,169 @@
+#include "array/array_fenwick.h"
+#include "unity.h"
+
+#define FENWICK_SIZE 1000U
+
+static int32_t values[FENWICK_SIZE];
+static int64_t tree[FENWICK_SIZE];
+static array_fenwick_t fw;
+
+void setUp(void)
+{
+    for (size_t i = 0U; i < FENWICK_SIZE; ++i)
+    {
+        values[i] = (int32_t) ((i * 7919U) % 100U);
+    }
+
+    array_fenwick_build(&fw, tree, values, FENWICK_SIZE);
+}
+
+void tearDown(void)
+{
+}
+
+static int64_t reference_prefix(size_t count)
+{
+    int64_t sum = 0;
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+        sum += values[i];
+    }
+
+    return sum;
+}
+
+// ----------- build / query tests -----------
+void test_array_fenwick_build_should_give_exact_prefix_sums(void)
+{
+    int64_t sum = 0;
+
+    for (size_t count = 0U; count <= FENWICK_SIZE; count += 37U)
+    {
+        TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_fenwick_prefix_sum(&fw, count, &sum));
+        TEST_ASSERT_EQUAL_INT64(reference_prefix(count), sum);
+    }
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_fenwick_prefix_sum(&fw, FENWICK_SIZE, &sum));
+    TEST_ASSERT_EQUAL_INT64(reference_prefix(FENWICK_SIZE), sum);
+}
+
+void test_array_fenwick_range_sum_should_match_reference(void)
+{
+    int64_t sum = 0;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_fenwick_range_sum(&fw, 123, 456, &sum));
+    TEST_ASSERT_EQUAL_INT64(reference_prefix(579) - reference_prefix(123), sum);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_fenwick_range_sum(&fw, 999, 1, &sum));
+    TEST_ASSERT_EQUAL_INT64(values[999], sum);
+}
+
+void test_array_fenwick_should_reject_invalid_arguments(void)
+{
+    array_fenwick_t other;
+    int64_t sum = 0;
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_NULL, array_fenwick_build(&other, NULL, values, 4));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_fenwick_build(&other, tree, values, 0));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_fenwick_prefix_sum(&fw, FENWICK_SIZE + 1U, &sum));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_fenwick_range_sum(&fw, 900, 101, &sum));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_EMPTY, array_fenwick_range_sum(&fw, 0, 0, &sum));
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_ERROR_INVALID_INPUT,
+                      array_fenwick_add(&fw, FENWICK_SIZE, 1));
+}
+
+// ----------- update tests -----------
+void test_array_fenwick_add_should_update_interleaved_queries(void)
+{
+    uint32_t state = 99U;
+    int64_t sum = 0;
+
+    for (size_t n = 0U; n < 500U; ++n)
+    {
+        state = state * 1664525U + 1013904223U;
+        size_t index = (state >> 8) % FENWICK_SIZE;
+        int32_t delta = (int32_t) (state % 21U) - 10;
+
+        TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_fenwick_add(&fw, index, delta));
+        values[index] += delta;
+
+        size_t count = (state >> 4) % (FENWICK_SIZE + 1U);
+        array_fenwick_prefix_sum(&fw, count, &sum);
+        TEST_ASSERT_EQUAL_INT64(reference_prefix(count), sum);
+    }
+}
+
+void test_array_fenwick_add_should_handle_int64_deltas(void)
+{
+    int64_t sum = 0;
+
+    array_fenwick_add(&fw, 0, (int64_t) INT32_MAX * 4);
+    array_fenwick_prefix_sum(&fw, 1, &sum);
+    TEST_ASSERT_EQUAL_INT64((int64_t) INT32_MAX * 4 + values[0], sum);
+}
+
+// ----------- lower_bound tests -----------
+void test_array_fenwick_lower_bound_should_find_cumulative_position(void)
+{
+    const int32_t weights[] = {3, 0, 2, 5, 0, 1};
+    int64_t small_tree[6];
+    array_fenwick_t small;
+    size_t index = 0U;
+
+    array_fenwick_build(&small, small_tree, weights, 6);
+
+    TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_fenwick_lower_bound(&small, 1, &index));
+    TEST_ASSERT_EQUAL_size_t(0, index);
+
+    array_fenwick_lower_bound(&small, 4, &index);
+    TEST_ASSERT_EQUAL_size_t(2, index);
+
+    array_fenwick_lower_bound(&small, 6, &index);
+    TEST_ASSERT_EQUAL_size_t(3, index);
+
+    array_fenwick_lower_bound(&small, 11, &index);
+    TEST_ASSERT_EQUAL_size_t(5, index);
+
+    array_fenwick_lower_bound(&small, 12, &index);
+    TEST_ASSERT_EQUAL_size_t(6, index);
+}
+
+void test_array_fenwick_lower_bound_should_match_linear_scan(void)
+{
+    size_t index = 0U;
+
+    for (int64_t target = 1; target <= reference_prefix(FENWICK_SIZE); target += 997)
+    {
+        size_t want = 0U;
+        while (reference_prefix(want + 1U) < target)
+        {
+            ++want;
+        }
+
+        TEST_ASSERT_EQUAL(ARRAY_STATUS_OK, array_fenwick_lower_bound(&fw, target, &index));
+        TEST_ASSERT_EQUAL_size_t(want, index);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // ----------- build / query tests -----------
+    RUN_TEST(test_array_fenwick_build_should_give_exact_prefix_sums);
+    RUN_TEST(test_array_fenwick_range_sum_should_match_reference);
+    RUN_TEST(test_array_fenwick_should_reject_invalid_arguments);
+
+    // ----------- update tests -----------
+    RUN_TEST(test_array_fenwick_add_should_update_interleaved_queries);
+    RUN_TEST(test_array_fenwick_add_should_handle_int64_deltas);
+
+    // ----------- lower_bound tests -----------
+    RUN_TEST(test_array_fenwick_lower_bound_should_find_cumulative_position);
+    RUN_TEST(test_array_fenwick_lower_bound_should_match_linear_scan);
+
+    return UNITY_END();
+}